@@ -0,0 +1,56 @@
+// Times the number formatters against the per-call stringstream + std::locale("") path the old TextIntFormatted used.
+// Usage: bench_number_format [iterations]
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <sstream>
+#include <locale>
+#include <algorithm>
+
+#include <imgui.h>
+
+#include "customText/imguiTextFormats.h"
+
+using bench_clock = std::chrono::high_resolution_clock;
+
+static volatile size_t bench_sink; // keeps the loops from being optimized away
+
+template <typename F>
+static double NsPerCall(int count, F&& fn)
+{
+    size_t sink = 0;
+    auto t0 = bench_clock::now();
+    for (int i = 0; i < count; ++i)
+        sink += fn(i);
+    auto t1 = bench_clock::now();
+    bench_sink = sink;
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / count;
+}
+
+int main(int argc, char** argv) {
+    const int count = argc > 1 ? std::max(std::atoi(argv[1]), 1) : 200000;
+    char buf[64];
+
+    const double ns_stream = NsPerCall(count, [](int i) {
+        std::stringstream ss;
+        ss.imbue(std::locale(""));
+        ss << (i * 7919);
+        return ss.str().size();
+    });
+    const double ns_int = NsPerCall(count, [&](int i) {
+        return strlen(ImGui::FormatIntGrouped(buf, IM_ARRAYSIZE(buf), (long long)i * 7919));
+    });
+    const double ns_float = NsPerCall(count, [&](int i) {
+        return strlen(ImGui::FormatFloatGrouped(buf, IM_ARRAYSIZE(buf), i * -7919.123, 2));
+    });
+    const double ns_bytes = NsPerCall(count, [&](int i) {
+        return strlen(ImGui::FormatBytes(buf, IM_ARRAYSIZE(buf), (ImU64)i * 104729u));
+    });
+
+    std::printf("%d iterations\n", count);
+    std::printf("stringstream + locale: %8.1f ns/call\n", ns_stream);
+    std::printf("FormatIntGrouped:      %8.1f ns/call (%.1fx)\n", ns_int, ns_stream / std::max(ns_int, 1e-3));
+    std::printf("FormatFloatGrouped:    %8.1f ns/call\n", ns_float);
+    std::printf("FormatBytes:           %8.1f ns/call\n", ns_bytes);
+    return 0;
+}
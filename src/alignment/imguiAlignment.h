@@ -3,6 +3,7 @@
 #include <utility>
 #include <imgui.h>
 #include <imgui_internal.h>
+#include "imguiContextData.h"
 
 enum class AlignX { Left, Center, Right };
 enum class AlignY { Top, Middle, Bottom };
@@ -61,6 +62,21 @@ namespace
 	{
 		st->SetBool(AlignPresentKey(base, tag), false);
 	}
+	// Writes the 3 storage keys used by AlignSetVec2 for tag
+	inline int AlignVec2Keys(ImGuiID base, const char* tag, ImGuiID* out)
+	{
+		ImGuiID k = AlignKey(base, tag);
+		out[0] = AlignPresentKey(base, tag);
+		out[1] = ImHashStr("##x", 0, k);
+		out[2] = ImHashStr("##y", 0, k);
+		return 3;
+	}
+	// Marks the cached Vec2 of tag as used this frame, so it is reclaimed once the group stops being drawn
+	inline void AlignTouchVec2(ImGuiID base, const char* tag)
+	{
+		ImGuiID keys[3];
+		ImGui::TouchWidgetState(ImGui::GetCurrentWindowRead(), AlignKey(base, tag), keys, AlignVec2Keys(base, tag, keys));
+	}
 	static inline ImU32 WithAlphaMul(ImU32 col, float a01)
 	{
 		ImVec4 c = ImGui::ColorConvertU32ToFloat4(col);
@@ -176,6 +192,17 @@ namespace ImGui
 
 		bool const shouldAdjust = keep_updating || ShouldAdjust(st, base);
 
+		{
+			// Sizes, cursor and the window size seen by ShouldAdjust
+			ImGuiID keys[9];
+			int key_count = AlignVec2Keys(base, size_cache_tag, keys);
+			key_count += AlignVec2Keys(base, cursor_cache_tag, keys + key_count);
+			keys[key_count++] = ImHashStr("##w", 0, base);
+			keys[key_count++] = ImHashStr("##h", 0, base);
+			keys[key_count++] = ImHashStr("##frames", 0, base);
+			ImGui::TouchWidgetState(ImGui::GetCurrentWindowRead(), ImHashStr(cursor_cache_tag, 0, AlignKey(base, size_cache_tag)), keys, key_count);
+		}
+
 		if (newPass)
 		{
 			ImGui::PushStyleVar(ImGuiStyleVar_Alpha, 0.f);
@@ -310,6 +337,7 @@ namespace ImGui
 		}
 
 		AlignSetVec2(st, base, cache_tag, ImGui::GetItemRectSize());
+		AlignTouchVec2(base, cache_tag);
 	}
 
 	/*
@@ -368,6 +396,7 @@ namespace ImGui
 		}
 
 		AlignSetVec2(st, base, cache_tag, ImGui::GetItemRectSize());
+		AlignTouchVec2(base, cache_tag);
 	}
 
 	/*
@@ -433,6 +462,7 @@ namespace ImGui
 
 			if (MeasuredRowH > 0.0f)
 				AlignSetVec2(St, Base, kRowH, ImVec2(0.0f, MeasuredRowH));
+			AlignTouchVec2(Base, kRowH);
 		}
 
 		/*
@@ -465,6 +495,7 @@ namespace ImGui
 
 			// Update caches for next frame
 			AlignSetVec2(St, Base, item_tag, measured);
+			AlignTouchVec2(Base, item_tag);
 
 			// Track row max height for next frame
 			if (measured.y > MeasuredRowH)
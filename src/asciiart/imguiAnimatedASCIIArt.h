@@ -1,6 +1,7 @@
 #pragma once
 #include "imguiASCIIArt.h"
 #include <imgui_internal.h>
+#include "imguiAnimClock.h"
 #include <fstream>
 #include <sstream>
 #include <vector>
@@ -52,6 +53,8 @@ namespace ImGui
                     }
                 }
             }
+            if (anim.playing)
+                ImGui::AnimWakeAt(anim.last_switch_time + anim.frame_duration); // nothing changes until the next frame is due
         }
 
         anim.current_frame = ImClamp(anim.current_frame, 0, (int)anim.frames.size() - 1);
@@ -1,7 +1,12 @@
 #pragma once
 #include "imguiAnimText.h"
 #include "imguiTextFormats.h"
+#include "imguiTextTicker.h"
 #include "demo_module.h"
+#include <GLFW/glfw3.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 class CustomTextDemo : public DemoModule
 {
@@ -86,7 +91,13 @@ inline void CustomTextDemo::DrawSelectedDemo()
     ImGui::Text("10000 ->"); ImGui::SameLine();  ImGui::TextIntFormatted(10000);
     ImGui::Text("100000000 ->"); ImGui::SameLine();  ImGui::TextIntFormatted(100000000);
     ImGui::Text("1234567890 ->"); ImGui::SameLine();  ImGui::TextIntFormatted(1234567890);
-
+    ImGui::Text("FormatFloatGrouped(-9876543.21) -> %s", ImGui::FormatFloatGrouped(nullptr, 0, -9876543.21));
+    ImGui::Text("FormatFloatScientific(6.02214076e23) -> %s", ImGui::FormatFloatScientific(nullptr, 0, 6.02214076e23));
+    ImGui::Text("FormatBytes(1536) -> %s", ImGui::FormatBytes(nullptr, 0, 1536));
+    ImGui::Text("FormatBytes(5000000000, SI) -> %s", ImGui::FormatBytes(nullptr, 0, 5000000000ull, 2, true));
+    ImGui::Text("FormatDuration(0.0125) -> %s", ImGui::FormatDuration(nullptr, 0, 0.0125));
+    ImGui::Text("FormatDuration(7387) -> %s", ImGui::FormatDuration(nullptr, 0, 7387.0));
+    ImGui::Text("FormatSI(1.5e6, \"B/s\") -> %s", ImGui::FormatSI(nullptr, 0, 1.5e6, "B/s"));
 
     ImGui::Spacing();
 }
@@ -98,6 +109,41 @@ inline void CustomTextDemo::OnPrePanel()
 
 
 
+// Background threads feeding the streaming ticker preview
+struct TickerDemoProducers
+{
+    std::vector<std::thread> Threads;
+    std::atomic<bool>        Running{ false };
+    std::atomic<int>         Rate{ 5 };     // messages per second per thread
+
+    void Start(ImGui::TextTicker* ticker, int thread_count)
+    {
+        Stop();
+        Running = true;
+        for (int t = 0; t < thread_count; ++t)
+            Threads.emplace_back([this, ticker, t]() {
+                const ImU32 cols[] = { IM_COL32(255, 200, 80, 255), IM_COL32(120, 220, 255, 255), IM_COL32(160, 255, 140, 255), IM_COL32(255, 140, 200, 255) };
+                char msg[64];
+                for (int n = 0; Running; ++n)
+                {
+                    snprintf(msg, sizeof(msg), "[producer %d] event #%d", t, n);
+                    ticker->Push(msg, cols[t % 4]);
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1000 / ImMax(Rate.load(), 1)));
+                }
+            });
+    }
+
+    void Stop()
+    {
+        Running = false;
+        for (std::thread& th : Threads)
+            th.join();
+        Threads.clear();
+    }
+
+    ~TickerDemoProducers() { Stop(); }
+};
+
 inline void CustomTextDemo::DrawDemoPanel()
 {
     #pragma region Variables
@@ -149,6 +195,9 @@ inline void CustomTextDemo::DrawDemoPanel()
     static float tl_max_width = -1.0f;   // -1 = content region
     static float tl_padding_x = 0.0f;
     static int   tl_tooltip_mode = 0;     // 0 = full, 1 = cutoff, 2 = none
+    static bool  tl_cached = false;
+    static bool  tl_cut_middle = false;
+    static bool  tl_path_table = false;
 
     // TextWrappedLimited params
     static float twl_max_width = -1.0f; // -1 = content region
@@ -174,6 +223,29 @@ inline void CustomTextDemo::DrawDemoPanel()
 	static bool  mq_loop = true;
 	static bool  mq_restart = false;
 	static float mq_gap = -1.0f;
+
+    // Stacked effects params (reuse the wobble / shaky / gradient params above)
+    static bool  fx_wobble = true;
+    static bool  fx_shake = false;
+    static bool  fx_gradient = true;
+    static bool  fx_reveal = true;
+    static float fx_reveal_cps = 20.0f;   // glyphs per second
+    static float fx_reveal_fade = 4.0f;   // glyphs
+    static double fx_reveal_start = 0.0;
+
+    // Ticker params (the ticker must outlive its producers, so it is declared first)
+    static ImGui::TextTicker tk_ticker(256, 64);
+    tk_ticker.WakeUp = glfwPostEmptyEvent; // producers push while the demo may be idle
+    static TickerDemoProducers tk_producers;
+    static int   tk_thread_count = 2;
+    static int   tk_rate = 5;
+    static float tk_gap = 40.0f;
+
+    // Typewriter params
+    static float tw_cps = 40.0f;
+    static float tw_fade = 3.0f;
+    static bool  tw_wrap = true;
+    static double tw_start = 0.0;
     #pragma endregion
 
     // --------------------------------------------------------------------
@@ -188,6 +260,7 @@ inline void CustomTextDemo::DrawDemoPanel()
         ImGui::TextUnformatted(text_buf);
         break;
     case 1: // Wobble
+        ImGui::SetNextAnimTextID("##Preview"); // text_buf is edited live, keep it in one template slot
         ImGui::TextWobble(text_buf, wobble_amp, wobble_freq, wobble_speed);
         break;
     case 2: // Shaky
@@ -199,6 +272,7 @@ inline void CustomTextDemo::DrawDemoPanel()
         {
             grad_inputStops[i] = grad_stops[i];
         }
+        ImGui::SetNextAnimTextID("##Preview");
         if (!grad_animated)
         {
             ImGui::TextGradient(text_buf, grad_inputStops, grad_stopCount);
@@ -210,7 +284,57 @@ inline void CustomTextDemo::DrawDemoPanel()
         break;
     }
     case 4: // Single-line limited
-        ImGui::TextLimited(text_buf, tl_cut_left, tl_max_width, tl_padding_x, tl_flags);
+        if (tl_cut_middle && tl_path_table)
+        {
+            // Thousands of path rows, only the visible ones are submitted. With "Cached" each row reuses its cut points.
+            static std::vector<std::string> paths;
+            if (paths.empty())
+            {
+                const char* dirs[] = { "/home/user/projects", "/mnt/storage/shared/assets", "C:\\Users\\someone\\Documents", "/var/lib/app/cache/thumbnails" };
+                char buf[256];
+                for (int i = 0; i < 5000; ++i)
+                {
+                    snprintf(buf, sizeof(buf), "%s/batch_%03d/textures/material_%05d_albedo.png", dirs[i % IM_ARRAYSIZE(dirs)], i / 50, i);
+                    paths.push_back(buf);
+                }
+            }
+            if (ImGui::BeginTable("##PathTable", 2, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg,
+                ImVec2(tl_max_width >= 0.0f ? tl_max_width : 0.0f, ImGui::GetTextLineHeightWithSpacing() * 10.0f)))
+            {
+                ImGui::TableSetupColumn("#", ImGuiTableColumnFlags_WidthFixed);
+                ImGui::TableSetupColumn("Path", ImGuiTableColumnFlags_WidthStretch);
+                ImGuiListClipper clipper;
+                clipper.Begin((int)paths.size());
+                while (clipper.Step())
+                {
+                    for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+                    {
+                        ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%d", row);
+                        ImGui::TableNextColumn();
+                        ImGui::PushID(row);
+                        if (tl_cached)
+                            ImGui::TextLimitedMiddleCached("path", paths[row].c_str(), -1.0f, tl_padding_x, tl_flags);
+                        else
+                            ImGui::TextLimitedMiddle(paths[row].c_str(), -1.0f, tl_padding_x, tl_flags);
+                        ImGui::PopID();
+                    }
+                }
+                ImGui::EndTable();
+            }
+        }
+        else if (tl_cut_middle)
+        {
+            if (tl_cached)
+                ImGui::TextLimitedMiddleCached("CustomTextDemo_LimitedPreview", text_buf, tl_max_width, tl_padding_x, tl_flags);
+            else
+                ImGui::TextLimitedMiddle(text_buf, tl_max_width, tl_padding_x, tl_flags);
+        }
+        else if (tl_cached)
+            ImGui::TextLimitedCached("CustomTextDemo_LimitedPreview", text_buf, tl_cut_left, tl_max_width, tl_padding_x, tl_flags);
+        else
+            ImGui::TextLimited(text_buf, tl_cut_left, tl_max_width, tl_padding_x, tl_flags);
         break;
     case 5: // Wrapped + height-limited
         ImGui::TextWrappedLimited(
@@ -235,6 +359,35 @@ inline void CustomTextDemo::DrawDemoPanel()
             text_bufs,
 			mq_width, mq_speed, mq_right_to_left, mq_gap, mq_loop);
         break;
+    case 8: // Stacked effects
+    {
+        ImGui::TextEffect fx;
+        if (fx_wobble)
+            fx.Wobble(wobble_amp, wobble_freq, wobble_speed);
+        if (fx_shake)
+            fx.Shake(shaky_spread_x, shaky_spread_y, shaky_speed, shaky_chaos, shaky_roughness);
+        if (fx_gradient)
+        {
+            for (int i = 0; i < grad_stopCount; ++i)
+                grad_inputStops[i] = grad_stops[i];
+            fx.Gradient(grad_inputStops, grad_stopCount, grad_animated ? (grad_pingpong ? 2 : 1) : 0, grad_speed);
+        }
+        if (fx_reveal)
+        {
+            fx.RevealCount((float)(ImGui::GetTime() - fx_reveal_start) * fx_reveal_cps, fx_reveal_fade);
+            ImGui::AnimActiveUntil(fx_reveal_start + (strlen(text_buf) + fx_reveal_fade) / ImMax(fx_reveal_cps, 1e-3f));
+        }
+        ImGui::SetNextAnimTextID("##Preview");
+        ImGui::TextEffects(text_buf, fx);
+        break;
+    }
+    case 9: // Streaming ticker
+        ImGui::TextMarqueeTicker("CustomTextDemo_TickerPreview", tk_ticker, mq_width, mq_speed, tk_gap, mq_right_to_left);
+        break;
+    case 10: // Typewriter
+        ImGui::SetNextAnimTextID("##Preview");
+        ImGui::TextTypewriterTimed(text_buf, tw_start, tw_cps, tw_fade, tw_wrap ? -1.0f : 0.0f);
+        break;
     }
     ImGui::EndGroup();
 
@@ -289,6 +442,9 @@ inline void CustomTextDemo::DrawDemoPanel()
         "Wrapped Limited (Multi-line, Height Clamp)",
 		"Marquee (Single-line, Scrolling)",
 		"Marquee (Multi-line, Scrolling)",
+        "Stacked Effects (Animated)",
+        "Ticker (Streaming, Multi-threaded)",
+        "Typewriter (Progressive Reveal)",
     };
     ImGui::Combo("Type", &text_type, text_type_items, IM_ARRAYSIZE(text_type_items));
 
@@ -310,6 +466,80 @@ inline void CustomTextDemo::DrawDemoPanel()
 		DrawHelpTooltip("Number of complete wave cycles per text length.");
         ImGui::SliderFloat("Speed", &wobble_speed, 0.0f, 5.0f, "%.2f cycles/s");
 		DrawHelpTooltip("Wobble speed in cycles per second.");
+        {
+            // Kernel set used by all the animated text effects (wobble, shaky, gradient)
+            static int kernel_level = AnimKernels::KernelLevel_Auto;
+            const char* kernel_names[] = { "Auto", "Scalar", "SSE2", "AVX2", "NEON" };
+            if (ImGui::BeginCombo("Vertex Kernels", kernel_names[kernel_level + 1]))
+            {
+                for (int level = AnimKernels::KernelLevel_Auto; level < AnimKernels::KernelLevel_COUNT; ++level)
+                {
+                    const bool supported = level == AnimKernels::KernelLevel_Auto || AnimKernels::IsLevelSupported(level);
+                    ImGui::BeginDisabled(!supported);
+                    if (ImGui::Selectable(kernel_names[level + 1], kernel_level == level) && AnimKernels::SetLevel(level))
+                        kernel_level = level;
+                    ImGui::EndDisabled();
+                }
+                ImGui::EndCombo();
+            }
+            DrawHelpTooltip("Per-vertex kernels used by the animated text effects. Auto picks the widest SIMD set this CPU supports.");
+            ImGui::SameLine();
+            ImGui::TextDisabled("(active: %s)", AnimKernels::Get().Name);
+        }
+
+        // AnimMath against libm: sinf vs fast_sin (with the max error seen over the run) and
+        // one ValueNoise1D call per seed vs ValueNoise1D_x8
+        {
+            static double bench_ns_sinf = -1.0, bench_ns_fast_sin = -1.0, bench_sin_err = 0.0;
+            static double bench_ns_noise = -1.0, bench_ns_noise_x8 = -1.0;
+            if (ImGui::Button("Run animation math benchmark"))
+            {
+                using clock = std::chrono::high_resolution_clock;
+                const int count = 1 << 20;
+                std::vector<float> xs(count), out(count);
+                std::vector<uint32_t> seeds(count);
+                for (int i = 0; i < count; ++i)
+                {
+                    xs[i] = (i * 0.00613f) - 3200.0f; // wide range, like unwrapped phases
+                    seeds[i] = (uint32_t)i * 2654435761u;
+                }
+                auto ns_per = [&](clock::time_point a, clock::time_point b) {
+                    return std::chrono::duration<double, std::nano>(b - a).count() / count;
+                };
+
+                auto t0 = clock::now();
+                for (int i = 0; i < count; ++i) out[i] = sinf(xs[i]);
+                auto t1 = clock::now();
+                double sink = out[count / 2];
+                for (int i = 0; i < count; ++i) out[i] = AnimMath::fast_sin(xs[i]);
+                auto t2 = clock::now();
+                bench_ns_sinf = ns_per(t0, t1);
+                bench_ns_fast_sin = ns_per(t1, t2);
+                bench_sin_err = 0.0;
+                for (int i = 0; i < count; ++i)
+                    bench_sin_err = ImMax(bench_sin_err, fabs((double)out[i] - sin((double)xs[i])));
+
+                const float t = (float)ImGui::GetTime();
+                t0 = clock::now();
+                for (int i = 0; i < count; ++i) out[i] = AnimMath::ValueNoise1D(seeds[i], t, 12.0f, 0.9f);
+                t1 = clock::now();
+                sink += out[count / 2];
+                AnimMath::ValueNoise1D_N(seeds.data(), count, t, 12.0f, 0.9f, out.data());
+                t2 = clock::now();
+                sink += out[count / 2];
+                bench_ns_noise = ns_per(t0, t1);
+                bench_ns_noise_x8 = ns_per(t1, t2);
+                static volatile double bench_sink; bench_sink = sink; // keeps the loops from being optimized away
+            }
+            DrawHelpTooltip("Times 1M evaluations each. fast_sin error is measured against double precision sin over the same inputs.");
+            if (bench_ns_sinf >= 0.0)
+            {
+                ImGui::Text("sinf: %.2f ns   fast_sin: %.2f ns (x%.1f, max error %.1e)",
+                    bench_ns_sinf, bench_ns_fast_sin, bench_ns_sinf / ImMax(bench_ns_fast_sin, 1e-3), bench_sin_err);
+                ImGui::Text("ValueNoise1D: %.2f ns   ValueNoise1D_x8: %.2f ns (x%.1f)",
+                    bench_ns_noise, bench_ns_noise_x8, bench_ns_noise / ImMax(bench_ns_noise_x8, 1e-3));
+            }
+        }
         break;
 
     case 2: // Shaky
@@ -324,6 +554,72 @@ inline void CustomTextDemo::DrawDemoPanel()
 		DrawHelpTooltip("Amount of randomness between characters (higher = more desync).");
         ImGui::SliderFloat("Roughness", &shaky_roughness, 0.0f, 1.0f, "%.2f");
 		DrawHelpTooltip("Movement smoothness (0=sharp, 1=smooth).");
+
+        // Per-glyph cost of the previous implementation (AddText + CalcTextSizeA per character) against AddTextShaky,
+        // both emitting the preview text into a private draw list
+        {
+            static double bench_ns_per_call = -1.0, bench_ns_single_pass = -1.0;
+            if (ImGui::Button("Run shaky benchmark") && text_buf[0] != 0)
+            {
+                using clock = std::chrono::high_resolution_clock;
+                ImFont* font = ImGui::GetFont();
+                const float size = ImGui::GetFontSize();
+                const float t = (float)ImGui::GetTime();
+                const char* text_end = text_buf + strlen(text_buf);
+                const int iterations = 200;
+                int glyphs = 0;
+                for (const char* p = text_buf; p < text_end; ++p)
+                    if ((*p & 0xC0) != 0x80) glyphs++; // count UTF-8 lead bytes
+
+                ImDrawList bench_dl(ImGui::GetDrawListSharedData());
+                auto reset = [&]() {
+                    bench_dl._ResetForNewFrame();
+                    bench_dl.PushClipRectFullScreen();
+                    bench_dl.PushTexture(font->ContainerAtlas->TexRef);
+                };
+
+                auto t0 = clock::now();
+                for (int it = 0; it < iterations; ++it)
+                {
+                    reset();
+                    ImVec2 pen(0.0f, 0.0f);
+                    unsigned int cp = 0;
+                    int i = 0;
+                    for (const char* p = text_buf; *p; )
+                    {
+                        const char* p0 = p;
+                        p += ImTextCharFromUtf8(&cp, p, nullptr);
+                        uint32_t sx = (uint32_t)(0x9E3779B9u * (i + 17)) ^ (uint32_t)cp;
+                        uint32_t sy = (uint32_t)(0x85EBCA6Bu * (i + 31)) ^ ((uint32_t)cp * 0xC2B2AE35u);
+                        sx += (uint32_t)(int32_t)(shaky_chaos * 997.0f);
+                        sy += (uint32_t)(int32_t)(shaky_chaos * 1511.0f);
+                        float jx = (AnimHelpers::ValueNoise1D(sx, t, shaky_speed, shaky_roughness) * 2.0f - 1.0f) * shaky_spread_x;
+                        float jy = (AnimHelpers::ValueNoise1D(sy, t, shaky_speed * 1.13f, shaky_roughness) * 2.0f - 1.0f) * shaky_spread_y;
+                        bench_dl.AddText(font, size, ImVec2(pen.x + jx, pen.y + jy), IM_COL32_WHITE, p0, p);
+                        pen.x += font->CalcTextSizeA(size, FLT_MAX, 0.0f, p0, p).x;
+                        ++i;
+                    }
+                }
+                auto t1 = clock::now();
+                for (int it = 0; it < iterations; ++it)
+                {
+                    reset();
+                    AnimHelpers::AddTextShaky(&bench_dl, font, size, ImVec2(0.0f, 0.0f), IM_COL32_WHITE, text_buf, text_end,
+                        shaky_spread_x, shaky_spread_y, shaky_speed, shaky_chaos, shaky_roughness, t, ImGui::GetTextLineHeightWithSpacing());
+                }
+                auto t2 = clock::now();
+
+                const double total_glyphs = (double)glyphs * iterations;
+                bench_ns_per_call = std::chrono::duration<double, std::nano>(t1 - t0).count() / total_glyphs;
+                bench_ns_single_pass = std::chrono::duration<double, std::nano>(t2 - t1).count() / total_glyphs;
+            }
+            DrawHelpTooltip("Emits the input text 200 times into an offscreen draw list, first with one AddText + CalcTextSizeA call per character (the old TextShaky), then with the single-pass AddTextShaky.");
+            if (bench_ns_per_call >= 0.0)
+            {
+                ImGui::Text("Per-character calls: %.1f ns/glyph", bench_ns_per_call);
+                ImGui::Text("Single pass:         %.1f ns/glyph", bench_ns_single_pass);
+            }
+        }
         break;
 
     case 3: // Gradient
@@ -347,13 +643,23 @@ inline void CustomTextDemo::DrawDemoPanel()
     {
         ImGui::TextDisabled("Single-line Limited Settings");
 
-        ImGui::Checkbox("Cut Left", &tl_cut_left);
+        ImGui::Checkbox("Cut Middle", &tl_cut_middle);
+        DrawHelpTooltip("Replace the middle of the text with \"...\", preferring to cut at '/' and '\\' so paths keep their root and file name.");
+        if (tl_cut_middle)
+        {
+            ImGui::Checkbox("Path Table", &tl_path_table);
+            DrawHelpTooltip("Show a clipped table of 5,000 paths instead of the input text.");
+        }
+        else
+            ImGui::Checkbox("Cut Left", &tl_cut_left);
         ImGui::SliderFloat("Max Width", &tl_max_width, -1.0f, 800.0f,
             (tl_max_width < 0.0f) ? "Content Region" : "%.0f px");
         ImGui::SliderFloat("Padding X", &tl_padding_x, 0.0f, 20.0f, "%.1f px");
 
         const char* tooltip_modes[] = { "Show full text", "Show only cutoff", "No tooltip" };
         ImGui::Combo("Tooltip Mode", &tl_tooltip_mode, tooltip_modes, IM_ARRAYSIZE(tooltip_modes));
+        ImGui::Checkbox("Cached", &tl_cached);
+        DrawHelpTooltip("Use TextLimitedCached / TextLimitedMiddleCached, which only refit the text when it, the width or the font changes.");
         break;
     }
 
@@ -396,6 +702,69 @@ inline void CustomTextDemo::DrawDemoPanel()
 		ImGui::Checkbox("Loop Lines", &mq_loop);
         break;
 	}
+    case 8: // Stacked effects
+    {
+        ImGui::TextDisabled("Stacked Effects Settings");
+        DrawHelpTooltip("All enabled stages run in one pass over the cached glyph vertices of the text. "
+            "The wobble, shaky and gradient parameters are shared with their own preview types.");
+        ImGui::Checkbox("Wobble", &fx_wobble);
+        ImGui::SameLine();
+        ImGui::Checkbox("Shake", &fx_shake);
+        ImGui::SameLine();
+        ImGui::Checkbox("Gradient", &fx_gradient);
+        ImGui::SameLine();
+        ImGui::Checkbox("Reveal", &fx_reveal);
+        if (fx_reveal)
+        {
+            ImGui::SliderFloat("Reveal Speed", &fx_reveal_cps, 1.0f, 200.0f, "%.0f glyphs/s");
+            ImGui::SliderFloat("Reveal Fade", &fx_reveal_fade, 1.0f, 20.0f, "%.1f glyphs");
+            if (ImGui::Button("Replay"))
+                fx_reveal_start = ImGui::GetTime();
+        }
+        break;
+    }
+    case 9: // Streaming ticker
+    {
+        ImGui::TextDisabled("Ticker Settings");
+        DrawHelpTooltip("Producer threads push messages into a lock-free bounded queue. The widget drains it every frame, "
+            "measures only new messages and retires them once they scroll off. Memory stays fixed: when the queue is full, "
+            "new messages are dropped.");
+        ImGui::SliderFloat("Visible Width", &mq_width, -1.0f, 800.0f,
+            (mq_width < 0.0f) ? "Content Region" : "%.0f px");
+        ImGui::SliderFloat("Speed", &mq_speed, 10.0f, 500.0f, "%.1f px/s");
+        ImGui::Checkbox("Right to Left", &mq_right_to_left);
+        ImGui::SliderFloat("Gap Between Messages", &tk_gap, 0.0f, 200.0f, "%.0f px");
+
+        ImGui::SliderInt("Producer Threads", &tk_thread_count, 1, 8);
+        if (ImGui::SliderInt("Rate", &tk_rate, 1, 200, "%d msg/s per thread"))
+            tk_producers.Rate = tk_rate;
+        if (tk_producers.Threads.empty())
+        {
+            if (ImGui::Button("Start Producers"))
+                tk_producers.Start(&tk_ticker, tk_thread_count);
+        }
+        else if (ImGui::Button("Stop Producers"))
+            tk_producers.Stop();
+        ImGui::SameLine();
+        if (ImGui::Button("Push From UI"))
+            tk_ticker.Push(text_buf);
+        ImGui::SameLine();
+        if (ImGui::Button("Clear"))
+            tk_ticker.Clear();
+        ImGui::Text("Active: %d  Dropped: %d", tk_ticker.GetActiveCount(), tk_ticker.GetDroppedCount());
+        break;
+    }
+    case 10: // Typewriter
+    {
+        ImGui::TextDisabled("Typewriter Settings");
+        DrawHelpTooltip("The full text is laid out once; each frame only the glyphs revealed so far are copied from the cached layout.");
+        ImGui::SliderFloat("Speed", &tw_cps, 1.0f, 500.0f, "%.0f glyphs/s");
+        ImGui::SliderFloat("Fade", &tw_fade, 1.0f, 20.0f, "%.1f glyphs");
+        ImGui::Checkbox("Wrap", &tw_wrap);
+        if (ImGui::Button("Replay"))
+            tw_start = ImGui::GetTime();
+        break;
+    }
 
     default:
         ImGui::TextDisabled("No extra settings for this type.");
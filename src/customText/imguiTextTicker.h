@@ -0,0 +1,261 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <imgui.h>
+#include <imgui_internal.h>
+#include "imguiAnimClock.h"
+
+// Streaming news-ticker style marquee.
+// Messages are pushed from any thread into a bounded lock-free queue and picked up by the widget on the UI thread,
+// which measures each message once, scrolls it across and retires it after it has left the visible area.
+// All memory is allocated when the ticker is created: a steady stream never allocates, whatever its rate.
+namespace ImGui
+{
+    static const int TEXT_TICKER_MESSAGE_MAX = 128; // bytes per message including the terminator, longer messages are truncated
+
+    struct TextTickerMessage
+    {
+        char  Text[TEXT_TICKER_MESSAGE_MAX];
+        ImU32 Col;      // 0 = ImGuiCol_Text
+    };
+
+    // Bounded multi-producer / single-consumer queue (Vyukov's bounded queue, single consumer side).
+    // Each cell carries a sequence number telling producers and the consumer whose turn it is, so Push and Pop
+    // never block and never allocate. Push fails when the queue is full.
+    class TextTickerQueue
+    {
+    public:
+        explicit TextTickerQueue(int capacity)
+            : Cells((size_t)ImUpperPowerOfTwo(ImMax(capacity, 2))), Mask(Cells.size() - 1)
+        {
+            for (size_t i = 0; i < Cells.size(); ++i)
+                Cells[i].Seq.store(i, std::memory_order_relaxed);
+        }
+        TextTickerQueue(const TextTickerQueue&) = delete;
+        TextTickerQueue& operator=(const TextTickerQueue&) = delete;
+
+        int Capacity() const { return (int)Cells.size(); }
+
+        // Any thread
+        bool Push(const char* text, ImU32 col)
+        {
+            Cell* cell;
+            size_t pos = EnqueuePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                cell = &Cells[pos & Mask];
+                const size_t seq = cell->Seq.load(std::memory_order_acquire);
+                const intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+                if (diff == 0)
+                {
+                    if (EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                    return false; // full
+                else
+                    pos = EnqueuePos.load(std::memory_order_relaxed);
+            }
+            ImStrncpy(cell->Msg.Text, text ? text : "", TEXT_TICKER_MESSAGE_MAX);
+            TrimPartialUtf8(cell->Msg.Text);
+            cell->Msg.Col = col;
+            cell->Seq.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer thread only
+        bool Pop(TextTickerMessage* out)
+        {
+            Cell& cell = Cells[DequeuePos & Mask];
+            if (cell.Seq.load(std::memory_order_acquire) != DequeuePos + 1)
+                return false; // empty, or the producer of this cell has not finished writing yet
+            *out = cell.Msg;
+            cell.Seq.store(DequeuePos + Mask + 1, std::memory_order_release);
+            DequeuePos++;
+            return true;
+        }
+
+    private:
+        // Drops a UTF-8 sequence cut short by the truncation to TEXT_TICKER_MESSAGE_MAX
+        static void TrimPartialUtf8(char* text)
+        {
+            const int len = (int)strlen(text);
+            if (len < TEXT_TICKER_MESSAGE_MAX - 1)
+                return;
+            int lead = len;
+            while (lead > 0 && ((unsigned char)text[lead - 1] & 0xC0) == 0x80)
+                lead--;
+            if (lead == 0)
+                return; // not UTF-8 to begin with
+            const unsigned char c = (unsigned char)text[lead - 1];
+            const int expected = c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : c >= 0xC0 ? 2 : 1;
+            if (len - (lead - 1) < expected)
+                text[lead - 1] = 0;
+        }
+
+        struct Cell
+        {
+            std::atomic<size_t> Seq{ 0 };
+            TextTickerMessage   Msg;
+        };
+
+        std::vector<Cell>   Cells;
+        const size_t        Mask;
+        alignas(64) std::atomic<size_t> EnqueuePos{ 0 };
+        alignas(64) size_t  DequeuePos = 0;
+    };
+
+    // Owns the queue and the messages currently on screen. Create one per ticker and keep it alive as long as
+    // producers may push into it. Everything but Push is UI thread only.
+    struct TextTicker
+    {
+        // queue_capacity: messages waiting to be shown before Push starts dropping them.
+        // max_entries: messages on screen (or waiting for room behind the last one) at once.
+        explicit TextTicker(int queue_capacity = 256, int max_entries = 64)
+            : Queue(queue_capacity), Entries((size_t)ImMax(max_entries, 1)) {}
+
+        // Any thread. Returns false (and counts the message as dropped) when the queue is full.
+        bool Push(const char* text, ImU32 col = 0)
+        {
+            if (Queue.Push(text, col))
+            {
+                if (WakeUp)
+                    WakeUp();
+                return true;
+            }
+            Dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        int  GetDroppedCount() const { return Dropped.load(std::memory_order_relaxed); }
+        int  GetActiveCount() const { return Count; }
+
+        void Clear()
+        {
+            TextTickerMessage msg;
+            while (Queue.Pop(&msg)) {}
+            Head = Count = 0;
+            Offset = 0.0;
+        }
+
+        struct Entry
+        {
+            TextTickerMessage Msg;
+            float  Width = 0.0f;
+            double Start = 0.0;     // position along the scroll axis, in the same space as Offset
+        };
+
+        // Called by Push after queuing a message, from the pushing thread. An application that stops rendering while
+        // nothing animates (see ImGui::GetAnimIdleTimeout) sets it to wake its UI thread, e.g. to glfwPostEmptyEvent.
+        void             (*WakeUp)() = nullptr;
+
+        TextTickerQueue    Queue;
+        std::atomic<int>   Dropped{ 0 };
+        std::vector<Entry> Entries; // ring, Head is the oldest
+        int                Head = 0;
+        int                Count = 0;
+        double             Offset = 0.0; // distance scrolled so far; the entry at Start is at the leading edge when Offset == Start
+        ImFont*            Font = nullptr;
+        float              FontSize = 0.0f;
+
+        Entry& At(int i) { return Entries[(size_t)((Head + i) % (int)Entries.size())]; }
+    };
+
+    // Scrolls the messages of ticker across a single line. Only messages pushed since the last frame are measured.
+    // gap: pixels between consecutive messages.
+    inline void TextMarqueeTicker(const char* str_id, TextTicker& ticker, float width = -1.0f, float speed = 80.0f,
+        float gap = 40.0f, bool right_to_left = true)
+    {
+        ImGuiWindow* window = ImGui::GetCurrentWindow();
+        if (window->SkipItems)
+            return;
+
+        ImGuiContext& g = *GImGui;
+        const ImGuiStyle& style = g.Style;
+
+        float region_w = (width >= 0.0f) ? width : ImGui::GetContentRegionAvail().x;
+        if (region_w <= 0.0f)
+            region_w = 1.0f;
+
+        // Scroll first, then drop the entries that are now fully past the trailing edge
+        ticker.Offset += (double)(g.IO.DeltaTime * speed);
+        while (ticker.Count > 0)
+        {
+            const TextTicker::Entry& e = ticker.At(0);
+            if (ticker.Offset - e.Start < (double)(region_w + e.Width))
+                break;
+            ticker.Head = (ticker.Head + 1) % (int)ticker.Entries.size();
+            ticker.Count--;
+        }
+        if (ticker.Count == 0)
+            ticker.Offset = 0.0; // idle: rebase so the scroll position never grows unbounded
+        else if (ticker.Offset > 65536.0)
+        {
+            // Busy for a long time: rebase on the oldest entry instead
+            const double base = ticker.At(0).Start;
+            for (int i = 0; i < ticker.Count; ++i)
+                ticker.At(i).Start -= base;
+            ticker.Offset -= base;
+        }
+
+        // A font change invalidates every measured width
+        if (ticker.Font != g.Font || ticker.FontSize != g.FontSize)
+        {
+            ticker.Font = g.Font;
+            ticker.FontSize = g.FontSize;
+            double start = ticker.Count > 0 ? ticker.At(0).Start : 0.0;
+            for (int i = 0; i < ticker.Count; ++i)
+            {
+                TextTicker::Entry& e = ticker.At(i);
+                e.Width = ImMax(ImGui::CalcTextSize(e.Msg.Text).x, 1.0f);
+                e.Start = start;
+                start += e.Width + gap;
+            }
+        }
+
+        // Drain new messages while there is room, measuring each one exactly once.
+        // When the entry ring is full the rest stays queued and producers see back-pressure through Push.
+        while (ticker.Count < (int)ticker.Entries.size())
+        {
+            TextTicker::Entry& e = ticker.At(ticker.Count);
+            if (!ticker.Queue.Pop(&e.Msg))
+                break;
+            e.Width = ImMax(ImGui::CalcTextSize(e.Msg.Text).x, 1.0f);
+            e.Start = ticker.Offset; // enters at the leading edge...
+            if (ticker.Count > 0)
+            {
+                const TextTicker::Entry& last = ticker.At(ticker.Count - 1);
+                e.Start = ImMax(e.Start, last.Start + last.Width + gap); // ...or queues up behind the previous one
+            }
+            ticker.Count++;
+        }
+        if (ticker.Count > 0 && speed != 0.0f)
+            ImGui::AnimActiveNextFrame(); // messages on screen or waiting to enter keep it scrolling
+
+        ImVec2 item_size(region_w, g.FontSize + style.FramePadding.y * 2.0f);
+        ImGuiID id = window->GetID(str_id);
+        ImRect bb(window->DC.CursorPos, window->DC.CursorPos + item_size);
+        ImGui::ItemSize(item_size, style.FramePadding.y);
+        if (!ImGui::ItemAdd(bb, id))
+            return;
+
+        ImDrawList* draw_list = window->DrawList;
+        const ImU32 col_text = ImGui::GetColorU32(ImGuiCol_Text);
+        const float text_y = bb.Min.y + style.FramePadding.y;
+
+        ImGui::PushClipRect(bb.Min, bb.Max, true);
+        for (int i = 0; i < ticker.Count; ++i)
+        {
+            const TextTicker::Entry& e = ticker.At(i);
+            const float travelled = (float)(ticker.Offset - e.Start);
+            if (travelled <= 0.0f)
+                break; // this one and all after it have not entered yet
+            const float x = right_to_left ? bb.Max.x - travelled : bb.Min.x - e.Width + travelled;
+            draw_list->AddText(ImVec2(x, text_y), e.Msg.Col ? e.Msg.Col : col_text, e.Msg.Text);
+        }
+        ImGui::PopClipRect();
+    }
+}
@@ -58,6 +58,12 @@ void DemoManager::DrawCustomImguiDemo()
 	bool drawn = ImGui::Begin(custom_demo_window_name, nullptr);
     if (!drawn) { ImGui::End(); return; }
 
+    ImGui::Checkbox("Idle when nothing animates", &idle_rendering);
+    DrawHelpTooltip("Animated widgets report how long they keep moving. When nothing does, the demo stops rendering "
+        "until input arrives or the next animation is due, instead of drawing every frame.");
+    ImGui::SameLine();
+    ImGui::TextDisabled("%.0f frames/s", rendered_fps);
+
     for (auto& module : demo_modules)
     {
 		module->DrawSelector();
@@ -75,6 +81,15 @@ void DemoManager::DrawCustomImguiDemo()
 
 void DemoManager::NewFrame()
 {
+    const double now = glfwGetTime();
+    frames_counted++;
+    if (now - frames_count_start >= 1.0)
+    {
+        rendered_fps = (float)(frames_counted / (now - frames_count_start));
+        frames_counted = 0;
+        frames_count_start = now;
+    }
+
     ImGui_ImplOpenGL3_NewFrame();
     ImGui_ImplGlfw_NewFrame();
 
@@ -6,6 +6,7 @@
 #include <backends/imgui_impl_opengl3.h>
 #include <GLFW/glfw3.h>
 #include "demo_module.h"
+#include "imguiAnimClock.h"
 
 class DemoManager
 {
@@ -24,6 +25,31 @@ public:
 		InitModules();
 	}
 
+	// Called before each frame instead of glfwPollEvents. While a widget animates (ImGui::GetAnimIdleTimeout() is 0)
+	// events are polled and frames follow each other at the swap interval; otherwise the thread sleeps until input
+	// arrives or the next animation deadline. Input is followed by a few frames for ImGui to settle (hover, popups).
+	static void WaitForNextFrame()
+	{
+		double timeout = idle_rendering ? ImGui::GetAnimIdleTimeout() : 0.0;
+		if (ImGui::GetIO().WantTextInput || ImGui::IsAnyItemHovered())
+			timeout = ImMin(timeout, idle_busy_wait); // text cursor blink, tooltip delays
+		if (settle_frames > 0)
+		{
+			settle_frames--;
+			timeout = 0.0;
+		}
+		if (timeout <= 0.0)
+		{
+			glfwPollEvents();
+			return;
+		}
+		const double wait = ImMin(timeout, idle_max_wait);
+		const double start = glfwGetTime();
+		glfwWaitEventsTimeout(wait);
+		if (glfwGetTime() - start < wait)
+			settle_frames = idle_settle_frames; // woken by an event
+	}
+
 	static void NewFrame();
 
 	static void Draw();
@@ -72,5 +98,15 @@ private:
 
 	static void InitModules();
 	static inline std::vector<std::shared_ptr<DemoModule>> demo_modules;
+
+	// Idle rendering (see WaitForNextFrame)
+	static inline bool   idle_rendering = true;
+	static inline double idle_max_wait = 1.0;     // longest sleep, in case something animates without reporting it
+	static inline double idle_busy_wait = 0.1;    // longest sleep while typing or hovering an item
+	static inline int    idle_settle_frames = 3;  // frames rendered after an event
+	static inline int    settle_frames = 3;
+	static inline int    frames_counted = 0;
+	static inline double frames_count_start = 0.0;
+	static inline float  rendered_fps = 0.0f;
 };
 
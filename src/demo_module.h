@@ -1,5 +1,6 @@
 #pragma once
 #include <string>
+#include "imguiAnimClock.h"
 
 class DemoModule
 {
@@ -66,8 +67,7 @@ inline void DemoModule::DrawPopoutPanel()
 
 static void DrawPlaceholderText()
 {
-	float t = (float)ImGui::GetTime();
-	float hue = fmodf(t * 0.4f, 1.0f);
+	float hue = ImGui::AnimPhase(0.4);
 	ImVec4 col = ImColor::HSV(hue, 1.0f, 1.0f);
 	ImGui::PushStyleColor(ImGuiCol_Text, col);
 	ImGui::Text("Placeholder Text");
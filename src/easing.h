@@ -1,67 +1,96 @@
 #pragma once
-#include <corecrt_math.h>
-#include <corecrt_math_defines.h>
+#include <math.h>
+#include <imgui.h>
+#include "imguiContextData.h"
+
+// Easing curves over t in [0,1]. The algebraic ones (polynomials, back, bounce) are constexpr;
+// the ones built on sin/cos/pow/sqrt are plain inline, as the standard math functions are not constexpr in C++17.
+// Besides the functions, every curve has an EasingKind, evaluated through a switch by Easing::Evaluate, which
+// inlines and folds when the kind is known at compile time, and a table mode (Easing::EvaluateLut) for the
+// expensive elastic and bounce curves.
+enum EasingKind
+{
+	EasingKind_Linear = 0,
+	EasingKind_InSine, EasingKind_OutSine, EasingKind_InOutSine,
+	EasingKind_InQuad, EasingKind_OutQuad, EasingKind_InOutQuad,
+	EasingKind_InCubic, EasingKind_OutCubic, EasingKind_InOutCubic,
+	EasingKind_InQuart, EasingKind_OutQuart, EasingKind_InOutQuart,
+	EasingKind_InQuint, EasingKind_OutQuint, EasingKind_InOutQuint,
+	EasingKind_InExpo, EasingKind_OutExpo, EasingKind_InOutExpo,
+	EasingKind_InCirc, EasingKind_OutCirc, EasingKind_InOutCirc,
+	EasingKind_InBack, EasingKind_OutBack, EasingKind_InOutBack,
+	EasingKind_InElastic, EasingKind_OutElastic, EasingKind_InOutElastic,   // have a table (EvaluateLut)
+	EasingKind_InBounce, EasingKind_OutBounce, EasingKind_InOutBounce,      // have a table (EvaluateLut)
+	EasingKind_COUNT
+};
 
 namespace Easing
 {
+	static constexpr float kPi = 3.14159265358979323846f;
+
+	constexpr float pow2(float x) { return x * x; }
+	constexpr float pow3(float x) { return x * x * x; }
+	constexpr float pow4(float x) { return pow2(x) * pow2(x); }
+	constexpr float pow5(float x) { return pow4(x) * x; }
+
 	inline float easeInSine(float t) {
-		return 1.0f - cosf((t * M_PI) / 2.0f);
+		return 1.0f - cosf((t * kPi) / 2.0f);
 	}
 
 	inline float easeOutSine(float t) {
-		return sinf((t * M_PI) / 2.0f);
+		return sinf((t * kPi) / 2.0f);
 	}
 
 	inline float easeInOutSine(float t) {
-		return -(cosf(M_PI * t) - 1.0f) / 2.0f;
+		return -(cosf(kPi * t) - 1.0f) / 2.0f;
 	}
 
-	inline float easeInQuad(float t) {
+	constexpr float easeInQuad(float t) {
 		return t * t;
 	}
 
-	inline float easeOutQuad(float t) {
+	constexpr float easeOutQuad(float t) {
 		return 1.0f - (1.0f - t) * (1.0f - t);
 	}
 
-	inline float easeInOutQuad(float t) {
-		return t < 0.5f ? 2.0f * t * t : 1.0f - powf(-2.0f * t + 2.0f, 2) / 2.0f;
+	constexpr float easeInOutQuad(float t) {
+		return t < 0.5f ? 2.0f * t * t : 1.0f - pow2(-2.0f * t + 2.0f) / 2.0f;
 	}
 
-	inline float easeInCubic(float t) {
+	constexpr float easeInCubic(float t) {
 		return t * t * t;
 	}
 
-	inline float easeOutCubic(float t) {
-		return 1.0f - powf(1.0f - t, 3);
+	constexpr float easeOutCubic(float t) {
+		return 1.0f - pow3(1.0f - t);
 	}
 
-	inline float easeInOutCubic(float t) {
-		return t < 0.5f ? 4.0f * t * t * t : 1.0f - powf(-2.0f * t + 2.0f, 3) / 2.0f;
+	constexpr float easeInOutCubic(float t) {
+		return t < 0.5f ? 4.0f * t * t * t : 1.0f - pow3(-2.0f * t + 2.0f) / 2.0f;
 	}
 
-	inline float easeInQuart(float t) {
+	constexpr float easeInQuart(float t) {
 		return t * t * t * t;
 	}
 
-	inline float easeOutQuart(float t) {
-		return 1.0f - powf(1.0f - t, 4);
+	constexpr float easeOutQuart(float t) {
+		return 1.0f - pow4(1.0f - t);
 	}
 
-	inline float easeInOutQuart(float t) {
-		return t < 0.5f ? 8.0f * t * t * t * t : 1.0f - powf(-2.0f * t + 2.0f, 4) / 2.0f;
+	constexpr float easeInOutQuart(float t) {
+		return t < 0.5f ? 8.0f * t * t * t * t : 1.0f - pow4(-2.0f * t + 2.0f) / 2.0f;
 	}
 
-	inline float easeInQuint(float t) {
+	constexpr float easeInQuint(float t) {
 		return t * t * t * t * t;
 	}
 
-	inline float easeOutQuint(float t) {
-		return 1.0f - powf(1.0f - t, 5);
+	constexpr float easeOutQuint(float t) {
+		return 1.0f - pow5(1.0f - t);
 	}
 
-	inline float easeInOutQuint(float t) {
-		return t < 0.5f ? 16.0f * t * t * t * t * t : 1.0f - powf(-2.0f * t + 2.0f, 5) / 2.0f;
+	constexpr float easeInOutQuint(float t) {
+		return t < 0.5f ? 16.0f * t * t * t * t * t : 1.0f - pow5(-2.0f * t + 2.0f) / 2.0f;
 	}
 
 	inline float easeInExpo(float t) {
@@ -82,7 +111,7 @@ namespace Easing
 	}
 
 	inline float easeOutCirc(float t) {
-		return sqrtf(1.0f - powf(t - 1.0f, 2));
+		return sqrtf(1.0f - pow2(t - 1.0f));
 	}
 
 	inline float easeInOutCirc(float t) {
@@ -90,43 +119,43 @@ namespace Easing
 			return (1.0f - sqrtf(1.0f - 4.0f * t * t)) / 2.0f;
 		}
 		else {
-			return (sqrtf(1.0f - powf(-2.0f * t + 2.0f, 2)) + 1.0f) / 2.0f;
+			return (sqrtf(1.0f - pow2(-2.0f * t + 2.0f)) + 1.0f) / 2.0f;
 		}
 	}
 
-	inline float easeInBack(float t) {
+	constexpr float easeInBack(float t) {
 		const float c1 = 1.70158f;
 		const float c3 = c1 + 1.f;
 
 		return c3 * t * t * t - c1 * t * t;
 	}
 
-	inline float easeOutBack(float t) {
+	constexpr float easeOutBack(float t) {
 		const float c1 = 1.70158f;
 		const float c3 = c1 + 1.f;
-		return 1.0f + c3 * powf(t - 1.0f, 3) + c1 * powf(t - 1.0f, 2);
+		return 1.0f + c3 * pow3(t - 1.0f) + c1 * pow2(t - 1.0f);
 	}
 
-	inline float easeInOutBack(float t) {
+	constexpr float easeInOutBack(float t) {
 		const float c1 = 1.70158f;
 		const float c2 = c1 * 1.525f;
 		return (t < 0.5f) ?
-			(powf(2.0f * t, 2) * ((c2 + 1.f) * 2.0f * t - c2)) / 2.0f :
-			(powf(2.0f * t - 2.0f, 2) * ((c2 + 1.f) * (t * 2.0f - 2.0f) + c2) + 2.0f) / 2.0f;
+			(pow2(2.0f * t) * ((c2 + 1.f) * 2.0f * t - c2)) / 2.0f :
+			(pow2(2.0f * t - 2.0f) * ((c2 + 1.f) * (t * 2.0f - 2.0f) + c2) + 2.0f) / 2.0f;
 	}
 
 	inline float easeInElastic(float t) {
-		const float c4 = (2.0f * M_PI) / 3.0f;
+		const float c4 = (2.0f * kPi) / 3.0f;
 		return t == 0.0f ? 0.0f : (t == 1.0f ? 1.0f : -powf(2.0f, 10.0f * t - 10.0f) * sinf((t * 10.0f - 10.75f) * c4));
 	}
 
 	inline float easeOutElastic(float t) {
-		const float c4 = (2.0f * M_PI) / 3.0f;
+		const float c4 = (2.0f * kPi) / 3.0f;
 		return t == 0.0f ? 0.0f : (t == 1.0f ? 1.0f : powf(2.0f, -10.0f * t) * sinf((t * 10.0f - 0.75f) * c4) + 1.0f);
 	}
 
 	inline float easeInOutElastic(float t) {
-		const float c5 = (2.0f * M_PI) / 4.5f;
+		const float c5 = (2.0f * kPi) / 4.5f;
 		if (t == 0.0f || t == 1.0f) return t;
 		if (t < 0.5f) {
 			return -(powf(2.0f, 20.0f * t - 10.0f) * sinf((20.0f * t - 11.125f) * c5)) / 2.0f;
@@ -136,28 +165,31 @@ namespace Easing
 		}
 	}
 
-	inline float easeOutBounce(float t) {
+	constexpr float easeOutBounce(float t) {
 		const float n1 = 7.5625f;
 		const float d1 = 2.75f;
 		if (t < 1.f / d1) {
 			return n1 * t * t;
 		}
 		else if (t < 2.f / d1) {
-			return n1 * (t -= 1.5f / d1) * t + 0.75f;
+			const float u = t - 1.5f / d1;
+			return n1 * u * u + 0.75f;
 		}
 		else if (t < 2.5f / d1) {
-			return n1 * (t -= 2.25f / d1) * t + 0.9375f;
+			const float u = t - 2.25f / d1;
+			return n1 * u * u + 0.9375f;
 		}
 		else {
-			return n1 * (t -= 2.625f / d1) * t + 0.984375f;
+			const float u = t - 2.625f / d1;
+			return n1 * u * u + 0.984375f;
 		}
 	}
 
-	inline float easeInBounce(float t) {
+	constexpr float easeInBounce(float t) {
 		return 1.0f - easeOutBounce(1.0f - t);
 	}
 
-	inline float easeInOutBounce(float t) {
+	constexpr float easeInOutBounce(float t) {
 		if (t < 0.5f) {
 			return (1.0f - easeOutBounce(1.0f - 2.0f * t)) / 2.0f;
 		}
@@ -166,28 +198,184 @@ namespace Easing
 		}
 	}
 
+	// Evaluates the curve of kind at t. constexpr for the algebraic kinds.
+	constexpr float Evaluate(EasingKind kind, float t)
+	{
+		switch (kind)
+		{
+		case EasingKind_InSine:       return easeInSine(t);
+		case EasingKind_OutSine:      return easeOutSine(t);
+		case EasingKind_InOutSine:    return easeInOutSine(t);
+		case EasingKind_InQuad:       return easeInQuad(t);
+		case EasingKind_OutQuad:      return easeOutQuad(t);
+		case EasingKind_InOutQuad:    return easeInOutQuad(t);
+		case EasingKind_InCubic:      return easeInCubic(t);
+		case EasingKind_OutCubic:     return easeOutCubic(t);
+		case EasingKind_InOutCubic:   return easeInOutCubic(t);
+		case EasingKind_InQuart:      return easeInQuart(t);
+		case EasingKind_OutQuart:     return easeOutQuart(t);
+		case EasingKind_InOutQuart:   return easeInOutQuart(t);
+		case EasingKind_InQuint:      return easeInQuint(t);
+		case EasingKind_OutQuint:     return easeOutQuint(t);
+		case EasingKind_InOutQuint:   return easeInOutQuint(t);
+		case EasingKind_InExpo:       return easeInExpo(t);
+		case EasingKind_OutExpo:      return easeOutExpo(t);
+		case EasingKind_InOutExpo:    return easeInOutExpo(t);
+		case EasingKind_InCirc:       return easeInCirc(t);
+		case EasingKind_OutCirc:      return easeOutCirc(t);
+		case EasingKind_InOutCirc:    return easeInOutCirc(t);
+		case EasingKind_InBack:       return easeInBack(t);
+		case EasingKind_OutBack:      return easeOutBack(t);
+		case EasingKind_InOutBack:    return easeInOutBack(t);
+		case EasingKind_InElastic:    return easeInElastic(t);
+		case EasingKind_OutElastic:   return easeOutElastic(t);
+		case EasingKind_InOutElastic: return easeInOutElastic(t);
+		case EasingKind_InBounce:     return easeInBounce(t);
+		case EasingKind_OutBounce:    return easeOutBounce(t);
+		case EasingKind_InOutBounce:  return easeInOutBounce(t);
+		default:                      return t; // EasingKind_Linear
+		}
+	}
+
+	// ---- Table mode ----
+	static constexpr int LUT_SIZE = 256;   // intervals per table, linearly interpolated
+
+	constexpr bool HasLut(EasingKind kind) { return kind >= EasingKind_InElastic && kind <= EasingKind_InOutBounce; }
+
+	struct LutTables
+	{
+		float Samples[EasingKind_InOutBounce - EasingKind_InElastic + 1][LUT_SIZE + 1];
+
+		LutTables()
+		{
+			for (int k = EasingKind_InElastic; k <= EasingKind_InOutBounce; ++k)
+				for (int i = 0; i <= LUT_SIZE; ++i)
+					Samples[k - EasingKind_InElastic][i] = Evaluate((EasingKind)k, (float)i / LUT_SIZE);
+		}
+	};
+
+	// Tables of every HasLut() kind, built on first use (~6 KB)
+	inline const LutTables& GetLutTables()
+	{
+		static const LutTables tables;
+		return tables;
+	}
+
+	// Same as Evaluate, but the elastic and bounce kinds are read from a LUT_SIZE-interval table instead of being
+	// computed: a few times faster, within ~1e-3 of the exact elastic curves and ~1e-2 of bounce (at its kinks) (see the easing benchmark in the tween demo).
+	// t is clamped to [0,1] for those kinds.
+	inline float EvaluateLut(EasingKind kind, float t)
+	{
+		if (!HasLut(kind))
+			return Evaluate(kind, t);
+		const float* s = GetLutTables().Samples[kind - EasingKind_InElastic];
+		const float x = (t <= 0.0f ? 0.0f : (t >= 1.0f ? 1.0f : t)) * LUT_SIZE;
+		int i = (int)x;
+		if (i > LUT_SIZE - 1)
+			i = LUT_SIZE - 1;
+		return s[i] + (s[i + 1] - s[i]) * (x - (float)i);
+	}
+}
+
+namespace Easing
+{
+	// CSS cubic-bezier(x1, y1, x2, y2): the curve from (0,0) to (1,1) with control points (x1,y1) and (x2,y2).
+	// x1 and x2 are clamped to [0,1] so x grows with the curve parameter; y1 and y2 may overshoot.
+	// Evaluating at x solves x(t) = x for t from a table of x samples, refined by Newton-Raphson (one or two
+	// iterations in practice) with bisection where the curve is too flat for Newton. Callable, so it can be passed
+	// to Tween directly; see ImGui::GetCubicBezier for a cached instance.
+	struct CubicBezier
+	{
+		static constexpr int SAMPLES = 11;          // x at t = 0, 0.1 .. 1
+		static constexpr int NEWTON_ITERATIONS = 4;
+		static constexpr int BISECT_ITERATIONS = 20;
+
+		float X1 = 0.0f, Y1 = 0.0f, X2 = 1.0f, Y2 = 1.0f;
+		float Ax = 0.0f, Bx = 0.0f, Cx = 0.0f;      // x(t) = ((Ax t + Bx) t + Cx) t
+		float Ay = 0.0f, By = 0.0f, Cy = 0.0f;
+		float Samples[SAMPLES] = {};
+
+		constexpr CubicBezier() : CubicBezier(0.0f, 0.0f, 1.0f, 1.0f) {}
+		constexpr CubicBezier(float x1, float y1, float x2, float y2)
+		{
+			X1 = x1 < 0.0f ? 0.0f : (x1 > 1.0f ? 1.0f : x1);
+			X2 = x2 < 0.0f ? 0.0f : (x2 > 1.0f ? 1.0f : x2);
+			Y1 = y1;
+			Y2 = y2;
+			Cx = 3.0f * X1; Bx = 3.0f * (X2 - X1) - Cx; Ax = 1.0f - Cx - Bx;
+			Cy = 3.0f * Y1; By = 3.0f * (Y2 - Y1) - Cy; Ay = 1.0f - Cy - By;
+			for (int i = 0; i < SAMPLES; ++i)
+				Samples[i] = SampleX((float)i / (SAMPLES - 1));
+		}
+
+		constexpr float SampleX(float t) const { return ((Ax * t + Bx) * t + Cx) * t; }
+		constexpr float SampleY(float t) const { return ((Ay * t + By) * t + Cy) * t; }
+		constexpr float SlopeX(float t) const { return (3.0f * Ax * t + 2.0f * Bx) * t + Cx; }
+		constexpr bool  IsLinear() const { return X1 == Y1 && X2 == Y2; }
+
+		// Curve parameter t where x(t) = x, x in [0,1]
+		float SolveT(float x) const
+		{
+			const float step = 1.0f / (SAMPLES - 1);
+			int i = 0;
+			while (i < SAMPLES - 2 && Samples[i + 1] <= x)
+				++i;
+			// x grows strictly between samples, so the interval is never empty
+			float t = (i + (x - Samples[i]) / (Samples[i + 1] - Samples[i])) * step;
+			for (int n = 0; n < NEWTON_ITERATIONS; ++n)
+			{
+				const float err = SampleX(t) - x;
+				if (fabsf(err) < 1e-6f)
+					return t;
+				const float slope = SlopeX(t);
+				if (slope < 1e-3f)
+					break;
+				t -= err / slope;
+			}
+			// Flat part of the curve, or Newton left the sample interval: bisect it
+			float lo = i * step, hi = lo + step;
+			for (int n = 0; n < BISECT_ITERATIONS; ++n)
+			{
+				t = (lo + hi) * 0.5f;
+				const float err = SampleX(t) - x;
+				if (fabsf(err) < 1e-6f)
+					break;
+				if (err > 0.0f) hi = t; else lo = t;
+			}
+			return t;
+		}
+
+		float operator()(float x) const
+		{
+			if (IsLinear())
+				return x;
+			if (x <= 0.0f) return 0.0f;
+			if (x >= 1.0f) return 1.0f;
+			return SampleY(SolveT(x));
+		}
+	};
 }
 
 // --- ImGui specific helpers ---
 // (Remove this if you don't intend to use this)
-struct EasingEntry { const char* name; float (*fn)(float); };
+struct EasingEntry { const char* name; float (*fn)(float); EasingKind kind; };
 static constexpr EasingEntry EASING_FNS[] = {
-	{ "Linear (none)", nullptr },
-	{ "Sine In",       Easing::easeInSine },
-	{ "Sine Out",      Easing::easeOutSine },
-	{ "Sine InOut",    Easing::easeInOutSine },
-	{ "Quad InOut",    Easing::easeInOutQuad },
-	{ "Cubic Out",     Easing::easeOutCubic },
-	{ "Cubic InOut",   Easing::easeInOutCubic },
-	{ "Quart Out",     Easing::easeOutQuart },
-	{ "Quint Out",     Easing::easeOutQuint },
-	{ "Expo InOut",    Easing::easeInOutExpo },
-	{ "Circ InOut",    Easing::easeInOutCirc },
-	{ "Back InOut",    Easing::easeInOutBack },
-	{ "Elastic Out",   Easing::easeOutElastic },
-	{ "Elastic InOut", Easing::easeInOutElastic },
-	{ "Bounce Out",    Easing::easeOutBounce },
-	{ "Bounce InOut",  Easing::easeInOutBounce },
+	{ "Linear (none)", nullptr,                    EasingKind_Linear },
+	{ "Sine In",       Easing::easeInSine,         EasingKind_InSine },
+	{ "Sine Out",      Easing::easeOutSine,        EasingKind_OutSine },
+	{ "Sine InOut",    Easing::easeInOutSine,      EasingKind_InOutSine },
+	{ "Quad InOut",    Easing::easeInOutQuad,      EasingKind_InOutQuad },
+	{ "Cubic Out",     Easing::easeOutCubic,       EasingKind_OutCubic },
+	{ "Cubic InOut",   Easing::easeInOutCubic,     EasingKind_InOutCubic },
+	{ "Quart Out",     Easing::easeOutQuart,       EasingKind_OutQuart },
+	{ "Quint Out",     Easing::easeOutQuint,       EasingKind_OutQuint },
+	{ "Expo InOut",    Easing::easeInOutExpo,      EasingKind_InOutExpo },
+	{ "Circ InOut",    Easing::easeInOutCirc,      EasingKind_InOutCirc },
+	{ "Back InOut",    Easing::easeInOutBack,      EasingKind_InOutBack },
+	{ "Elastic Out",   Easing::easeOutElastic,     EasingKind_OutElastic },
+	{ "Elastic InOut", Easing::easeInOutElastic,   EasingKind_InOutElastic },
+	{ "Bounce Out",    Easing::easeOutBounce,      EasingKind_OutBounce },
+	{ "Bounce InOut",  Easing::easeInOutBounce,    EasingKind_InOutBounce },
 };
 static constexpr int EASING_FNS_COUNT = (int)IM_ARRAYSIZE(EASING_FNS);
 static int IndexFromEasing(float (*fn)(float))
@@ -195,4 +383,50 @@ static int IndexFromEasing(float (*fn)(float))
 	for (int i = 0; i < (int)IM_ARRAYSIZE(EASING_FNS); ++i)
 		if (EASING_FNS[i].fn == fn) return i;
 	return 0;
-}
\ No newline at end of file
+}
+
+namespace ImGui
+{
+	// Curves handed out by GetCubicBezier, freed with the context
+	struct CubicBezierCache
+	{
+		ImGuiStorage Curves; // control points hash -> Easing::CubicBezier*
+
+		~CubicBezierCache()
+		{
+			for (auto& pair : Curves.Data)
+				IM_DELETE((Easing::CubicBezier*)pair.val_p);
+		}
+	};
+
+	// Cubic-bezier curve for these control points, built on first request and kept until the ImGui context is destroyed,
+	// so the returned reference can be stored (e.g. in ToggleConfig::easingBezier). Meant for a set of fixed
+	// designer curves; for control points edited live, construct an Easing::CubicBezier directly.
+	// NaN control points have no curve: they get the linear one.
+	inline const Easing::CubicBezier& GetCubicBezier(float x1, float y1, float x2, float y2)
+	{
+		static const Easing::CubicBezier linear;
+		if (x1 != x1 || y1 != y1 || x2 != x2 || y2 != y2)
+			return linear;
+
+		static const ImGuiID owner = ImHashStr("##CubicBezierCache");
+		ImGuiStorage& cache = GetContextData<CubicBezierCache>(owner)->Curves;
+		const Easing::CubicBezier key_curve(x1, y1, x2, y2);
+		const float ctrl[4] = { key_curve.X1 + 0.0f, key_curve.Y1 + 0.0f, key_curve.X2 + 0.0f, key_curve.Y2 + 0.0f }; // + 0.0f: -0 hashes as 0
+		ImGuiID key = 2166136261u; // FNV-1a of the clamped control points
+		for (int i = 0; i < (int)sizeof(ctrl); ++i)
+			key = (key ^ ((const unsigned char*)ctrl)[i]) * 16777619u;
+		for (;; ++key) // linear probing on collisions
+		{
+			Easing::CubicBezier* curve = (Easing::CubicBezier*)cache.GetVoidPtr(key);
+			if (!curve)
+			{
+				curve = IM_NEW(Easing::CubicBezier)(key_curve);
+				cache.SetVoidPtr(key, curve);
+				return *curve;
+			}
+			if (curve->X1 == ctrl[0] && curve->Y1 == ctrl[1] && curve->X2 == ctrl[2] && curve->Y2 == ctrl[3])
+				return *curve;
+		}
+	}
+}
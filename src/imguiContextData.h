@@ -0,0 +1,342 @@
+#pragma once
+#include <vector>
+#include <imgui.h>
+#include <imgui_internal.h>
+
+// Small building blocks shared by the custom widgets that need state outside of ImGuiStorage.
+namespace ImGui
+{
+	// Returns a T owned by the current ImGui context. It is created on first use and destroyed with the context,
+	// so every context gets its own copy. owner must be unique per T, e.g. ImHashStr("##MyWidgetData").
+	template<typename T>
+	inline T* GetContextData(ImGuiID owner)
+	{
+		ImGuiContext& g = *GImGui;
+		for (const ImGuiContextHook& hook : g.Hooks)
+			if (hook.Owner == owner && hook.Type == ImGuiContextHookType_Shutdown)
+				return (T*)hook.UserData;
+
+		ImGuiContextHook hook;
+		hook.Type = ImGuiContextHookType_Shutdown;
+		hook.Owner = owner;
+		hook.UserData = IM_NEW(T)();
+		hook.Callback = [](ImGuiContext*, ImGuiContextHook* h) { IM_DELETE((T*)h->UserData); h->UserData = nullptr; };
+		ImGui::AddContextHook(&g, &hook);
+		return (T*)hook.UserData;
+	}
+
+	// 64-bit FNV-1a, used by the caches to detect text changes without keeping a copy of the text around
+	static inline ImU64 TextHash64(const char* text, const char* text_end)
+	{
+		ImU64 h = 0xcbf29ce484222325ULL;
+		for (const char* p = text; p < text_end; ++p)
+		{
+			h ^= (unsigned char)*p;
+			h *= 0x100000001b3ULL;
+		}
+		return h;
+	}
+
+	// Flat open-addressing map from ImGuiID to a slot index (linear probing, backward-shift removal).
+	// Lookups are O(1) and removal leaves no tombstones. ID 0 is reserved as the empty marker.
+	struct IDSlotMap
+	{
+		std::vector<ImGuiID> Keys;
+		std::vector<int>     Slots;
+		int                  Count = 0;
+
+		void Clear()
+		{
+			Keys.assign(Keys.size(), 0);
+			Count = 0;
+		}
+
+		// Makes room for at least capacity entries without rehashing (load factor <= 0.5).
+		void Reserve(int capacity)
+		{
+			int size = ImUpperPowerOfTwo(ImMax(capacity * 2, 16));
+			if (size <= (int)Keys.size())
+				return;
+			std::vector<ImGuiID> old_keys; old_keys.swap(Keys);
+			std::vector<int>     old_slots; old_slots.swap(Slots);
+			Keys.assign((size_t)size, 0);
+			Slots.assign((size_t)size, -1);
+			Count = 0;
+			for (size_t i = 0; i < old_keys.size(); ++i)
+				if (old_keys[i] != 0)
+					Insert(old_keys[i], old_slots[i]);
+		}
+
+		int Find(ImGuiID id) const
+		{
+			if (Keys.empty())
+				return -1;
+			const ImU32 mask = (ImU32)Keys.size() - 1;
+			for (ImU32 i = Hash(id) & mask; ; i = (i + 1) & mask)
+			{
+				if (Keys[i] == id) return Slots[i];
+				if (Keys[i] == 0)  return -1;
+			}
+		}
+
+		void Insert(ImGuiID id, int slot)
+		{
+			IM_ASSERT(id != 0);
+			if ((Count + 1) * 2 > (int)Keys.size())
+				Reserve(Count + 1);
+			const ImU32 mask = (ImU32)Keys.size() - 1;
+			ImU32 i = Hash(id) & mask;
+			while (Keys[i] != 0 && Keys[i] != id)
+				i = (i + 1) & mask;
+			if (Keys[i] == 0)
+				Count++;
+			Keys[i] = id;
+			Slots[i] = slot;
+		}
+
+		void Remove(ImGuiID id)
+		{
+			if (Keys.empty())
+				return;
+			const ImU32 mask = (ImU32)Keys.size() - 1;
+			ImU32 i = Hash(id) & mask;
+			while (Keys[i] != id)
+			{
+				if (Keys[i] == 0) return;
+				i = (i + 1) & mask;
+			}
+			// Shift following entries of the same probe run back so lookups never need tombstones
+			for (ImU32 j = (i + 1) & mask; Keys[j] != 0; j = (j + 1) & mask)
+			{
+				const ImU32 home = Hash(Keys[j]) & mask;
+				if (((j - home) & mask) >= ((j - i) & mask))
+				{
+					Keys[i] = Keys[j];
+					Slots[i] = Slots[j];
+					i = j;
+				}
+			}
+			Keys[i] = 0;
+			Slots[i] = -1;
+			Count--;
+		}
+
+	private:
+		static ImU32 Hash(ImGuiID id) { return id * 2654435761u; } // IDs are hashes already, this only spreads low bits
+	};
+
+	// Fixed-capacity least-recently-used cache keyed by ImGuiID. All memory is allocated on first use;
+	// when full, the least recently touched entry is recycled in O(1). Recycled values keep whatever
+	// capacity their own buffers had, so steady-state use does not allocate.
+	template<typename T>
+	struct IDLruCache
+	{
+		struct Node
+		{
+			ImGuiID Id = 0;
+			int     Prev = -1;
+			int     Next = -1;
+			T       Value;
+		};
+
+		std::vector<Node> Nodes;
+		IDSlotMap         Map;
+		int               Head = -1; // most recently used
+		int               Tail = -1; // least recently used
+		int               Used = 0;
+
+		void Init(int capacity)
+		{
+			IM_ASSERT(capacity > 0);
+			Nodes.clear();
+			Nodes.resize((size_t)capacity);
+			Map = IDSlotMap();
+			Map.Reserve(capacity);
+			Head = Tail = -1;
+			Used = 0;
+		}
+
+		int Capacity() const { return (int)Nodes.size(); }
+
+		// Returns the cached entry for id without marking it as used, or nullptr.
+		T* Peek(ImGuiID id)
+		{
+			const int n = Map.Find(id);
+			return n >= 0 ? &Nodes[n].Value : nullptr;
+		}
+
+		// Returns the entry for id and marks it as most recently used.
+		// out_created is set when the entry was not cached, its value is then a recycled one that the caller must reset.
+		T& Get(ImGuiID id, bool* out_created = nullptr)
+		{
+			IM_ASSERT(!Nodes.empty() && "IDLruCache::Init() must be called first");
+			int n = Map.Find(id);
+			const bool created = (n < 0);
+			if (created)
+			{
+				if (Used < Capacity())
+					n = Used++;
+				else
+				{
+					n = Tail;
+					Unlink(n);
+					Map.Remove(Nodes[n].Id);
+				}
+				Nodes[n].Id = id;
+				Map.Insert(id, n);
+				PushFront(n);
+			}
+			else if (n != Head)
+			{
+				Unlink(n);
+				PushFront(n);
+			}
+			if (out_created)
+				*out_created = created;
+			return Nodes[n].Value;
+		}
+
+	private:
+		void Unlink(int n)
+		{
+			Node& node = Nodes[n];
+			if (node.Prev >= 0) Nodes[node.Prev].Next = node.Next; else Head = node.Next;
+			if (node.Next >= 0) Nodes[node.Next].Prev = node.Prev; else Tail = node.Prev;
+			node.Prev = node.Next = -1;
+		}
+
+		void PushFront(int n)
+		{
+			Node& node = Nodes[n];
+			node.Prev = -1;
+			node.Next = Head;
+			if (Head >= 0) Nodes[Head].Prev = n;
+			Head = n;
+			if (Tail < 0) Tail = n;
+		}
+	};
+
+	// Removes key from storage. ImGuiStorage has no erase of its own; its pairs are kept sorted by key.
+	static inline bool StorageErase(ImGuiStorage* storage, ImGuiID key)
+	{
+		auto* first = storage->Data.Data;
+		int lo = 0, hi = storage->Data.Size;
+		while (lo < hi)
+		{
+			const int mid = (lo + hi) >> 1;
+			if (first[mid].key < key) lo = mid + 1; else hi = mid;
+		}
+		if (lo >= storage->Data.Size || first[lo].key != key)
+			return false;
+		storage->Data.erase(first + lo);
+		return true;
+	}
+
+	static int WIDGET_STATE_STALE_FRAMES = 600;     // widget state not touched for this many frames is removed from its window storage
+	static int WIDGET_STATE_SWEEP_PER_FRAME = 64;   // entries checked for staleness per frame
+	static const int WIDGET_STATE_MAX_KEYS = 12;    // storage keys one entry can own
+
+	// Remembers which window storage keys each custom widget wrote and the last frame it was submitted, so the keys of
+	// widgets that stopped being submitted (e.g. rows of a list that churns) can be removed instead of piling up.
+	struct WidgetStateTracker
+	{
+		struct Entry
+		{
+			ImGuiID Id;         // window ID + owner
+			ImGuiID WindowId;
+			int     LastFrame;
+			int     KeyCount;
+			ImGuiID Keys[WIDGET_STATE_MAX_KEYS];
+		};
+
+		IDSlotMap        Map;
+		ImVector<Entry>  Entries;
+		int              SweepCursor = 0;
+		int              SweepFrame = -1;
+		int              ReclaimedTotal = 0;  // entries reclaimed since the context was created
+
+		void Remove(int n)
+		{
+			Entry& e = Entries[n];
+			if (ImGuiWindow* window = ImGui::FindWindowByID(e.WindowId))
+				for (int k = 0; k < e.KeyCount; ++k)
+					StorageErase(&window->StateStorage, e.Keys[k]);
+			Map.Remove(e.Id);
+			if (n != Entries.Size - 1)
+			{
+				e = Entries.back();
+				Map.Insert(e.Id, n);
+			}
+			Entries.pop_back();
+			ReclaimedTotal++;
+		}
+
+		// Removes up to max_checks entries (round robin) not touched within max_idle_frames. Returns how many were removed.
+		int Sweep(int frame, int max_idle_frames, int max_checks)
+		{
+			int removed = 0;
+			for (int n = 0; n < max_checks && Entries.Size > 0; ++n)
+			{
+				if (SweepCursor >= Entries.Size)
+					SweepCursor = 0;
+				if (frame - Entries[SweepCursor].LastFrame > max_idle_frames)
+				{
+					Remove(SweepCursor); // the swapped in entry is checked next
+					removed++;
+				}
+				else
+					SweepCursor++;
+			}
+			return removed;
+		}
+	};
+
+	inline WidgetStateTracker& GetWidgetStateTracker()
+	{
+		static const ImGuiID owner = ImHashStr("##WidgetStateTracker");
+		return *GetContextData<WidgetStateTracker>(owner);
+	}
+
+	// Marks the storage keys owned by owner in window as used this frame. keys are only read the first time an owner is seen.
+	// Does nothing when the window storage was replaced with SetStateStorage(): the keys are not the window's to remove then.
+	inline void TouchWidgetState(ImGuiWindow* window, ImGuiID owner, const ImGuiID* keys, int key_count)
+	{
+		if (window->DC.StateStorage != &window->StateStorage)
+			return;
+		ImGuiContext& g = *GImGui;
+		WidgetStateTracker& tracker = GetWidgetStateTracker();
+		if (tracker.SweepFrame != g.FrameCount)
+		{
+			tracker.SweepFrame = g.FrameCount;
+			tracker.Sweep(g.FrameCount, WIDGET_STATE_STALE_FRAMES, WIDGET_STATE_SWEEP_PER_FRAME);
+		}
+
+		ImGuiID id = ImHashData(&owner, sizeof(owner), window->ID);
+		if (id == 0)
+			id = 1;
+		int n = tracker.Map.Find(id);
+		if (n < 0)
+		{
+			IM_ASSERT(key_count <= WIDGET_STATE_MAX_KEYS);
+			WidgetStateTracker::Entry e;
+			e.Id = id;
+			e.WindowId = window->ID;
+			e.KeyCount = ImMin(key_count, WIDGET_STATE_MAX_KEYS);
+			for (int k = 0; k < e.KeyCount; ++k)
+				e.Keys[k] = keys[k];
+			n = tracker.Entries.Size;
+			tracker.Entries.push_back(e);
+			tracker.Map.Insert(id, n);
+		}
+		tracker.Entries[n].LastFrame = g.FrameCount;
+	}
+
+	// Removes the storage of every widget not touched within max_idle_frames frames (default WIDGET_STATE_STALE_FRAMES)
+	// right away, instead of waiting for the incremental sweep. Returns how many were reclaimed.
+	inline int GcWidgetState(int max_idle_frames = -1)
+	{
+		WidgetStateTracker& tracker = GetWidgetStateTracker();
+		tracker.SweepCursor = 0;
+		return tracker.Sweep(GImGui->FrameCount, max_idle_frames >= 0 ? max_idle_frames : WIDGET_STATE_STALE_FRAMES, tracker.Entries.Size);
+	}
+}
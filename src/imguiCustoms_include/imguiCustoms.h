@@ -1,9 +1,17 @@
 #pragma once
 #include "imgui.h"
+// shared helpers used by the widgets below
+#include "inc/imguiContextData.h"
+#include "inc/imguiAnimClock.h"
+#include "inc/imguiAnimMath.h"
+#include "inc/imguiGradientLut.h"
+#include "inc/easing.h"
+// widgets
 #include "inc/imguiAlignment.h"
 #include "inc/imguiASCIIArt.h"
 #include "inc/imguiAnimatedASCIIArt.h"
 #include "inc/imguiAnimText.h"
+#include "inc/imguiAnimTextKernels.h"
 #include "inc/imguiCustomTooltip.h"
 #include "inc/imguiDockEnforcer.h"
 #include "inc/imguiLMP.h"
@@ -11,8 +19,11 @@
 #include "inc/imguiProgressBar.h"
 #include "inc/imguiSpinner.h"
 #include "inc/imguiTextFormats.h"
+#include "inc/imguiTextTicker.h"
 #include "inc/imguiToggle.h"
 #include "inc/imguiTween.h"
+#include "inc/imguiTimeline.h"
+#include "inc/imguiSpring.h"
 #include "inc/imguiWindowStore.h"
 
 // include this header to use all custom ImGui widgets and utilities
\ No newline at end of file
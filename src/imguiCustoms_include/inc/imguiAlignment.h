@@ -3,6 +3,7 @@
 #include <utility>
 #include <imgui.h>
 #include <imgui_internal.h>
+#include "imguiContextData.h"
 
 enum class AlignX { Left, Center, Right };
 enum class AlignY { Top, Middle, Bottom };
@@ -61,6 +62,21 @@ namespace
 	{
 		st->SetBool(AlignPresentKey(base, tag), false);
 	}
+	// Writes the 3 storage keys used by AlignSetVec2 for tag
+	inline int AlignVec2Keys(ImGuiID base, const char* tag, ImGuiID* out)
+	{
+		ImGuiID k = AlignKey(base, tag);
+		out[0] = AlignPresentKey(base, tag);
+		out[1] = ImHashStr("##x", 0, k);
+		out[2] = ImHashStr("##y", 0, k);
+		return 3;
+	}
+	// Marks the cached Vec2 of tag as used this frame, so it is reclaimed once the group stops being drawn
+	inline void AlignTouchVec2(ImGuiID base, const char* tag)
+	{
+		ImGuiID keys[3];
+		ImGui::TouchWidgetState(ImGui::GetCurrentWindowRead(), AlignKey(base, tag), keys, AlignVec2Keys(base, tag, keys));
+	}
 	static inline ImU32 WithAlphaMul(ImU32 col, float a01)
 	{
 		ImVec4 c = ImGui::ColorConvertU32ToFloat4(col);
@@ -153,6 +169,7 @@ namespace ImGui
 	@param restore_cursor_after - If true, restores the cursor position after rendering the aligned group. Best to leave true.
 	@param size_cache_tag	- A tag to identify the cached size of this group. Change if the contents change dynamically or use InvalidateAlignmentGroup
 	@param cursor_cache_tag - A tag to identify the cached cursor starting position of this group. Change if the contents change dynamically or use InvalidateAlignmentGroup
+	@param keep_updating - If true, the alignment group will keep updating its position every frame, even if the window size hasn't changed. This is useful for dynamic content that may change size or position frequently.
 	@return				- The start position where the aligned group was rendered.
 	*/
 	template<typename Widgets>
@@ -162,7 +179,8 @@ namespace ImGui
 		ImVec2 offset = ImVec2(0, 0),
 		bool restore_cursor_after = true,
 		const char* size_cache_tag = "ag_size",
-		const char* cursor_cache_tag = "ag_cursor")
+		const char* cursor_cache_tag = "ag_cursor",
+		bool keep_updating = false)
 	{
 		const ImVec2 cursor_before = ImGui::GetCursorPos();
 		ImGuiStorage* st = ImGui::GetStateStorage();
@@ -172,7 +190,18 @@ namespace ImGui
 		const bool hasCachedCursor = AlignHas(st, base, cursor_cache_tag);
 		const ImVec2 cursor_cached = AlignGetVec2(st, base, cursor_cache_tag, ImVec2(0, 0));
 
-		bool const shouldAdjust = ShouldAdjust(st, base);
+		bool const shouldAdjust = keep_updating || ShouldAdjust(st, base);
+
+		{
+			// Sizes, cursor and the window size seen by ShouldAdjust
+			ImGuiID keys[9];
+			int key_count = AlignVec2Keys(base, size_cache_tag, keys);
+			key_count += AlignVec2Keys(base, cursor_cache_tag, keys + key_count);
+			keys[key_count++] = ImHashStr("##w", 0, base);
+			keys[key_count++] = ImHashStr("##h", 0, base);
+			keys[key_count++] = ImHashStr("##frames", 0, base);
+			ImGui::TouchWidgetState(ImGui::GetCurrentWindowRead(), ImHashStr(cursor_cache_tag, 0, AlignKey(base, size_cache_tag)), keys, key_count);
+		}
 
 		if (newPass)
 		{
@@ -308,6 +337,7 @@ namespace ImGui
 		}
 
 		AlignSetVec2(st, base, cache_tag, ImGui::GetItemRectSize());
+		AlignTouchVec2(base, cache_tag);
 	}
 
 	/*
@@ -366,6 +396,7 @@ namespace ImGui
 		}
 
 		AlignSetVec2(st, base, cache_tag, ImGui::GetItemRectSize());
+		AlignTouchVec2(base, cache_tag);
 	}
 
 	/*
@@ -431,6 +462,7 @@ namespace ImGui
 
 			if (MeasuredRowH > 0.0f)
 				AlignSetVec2(St, Base, kRowH, ImVec2(0.0f, MeasuredRowH));
+			AlignTouchVec2(Base, kRowH);
 		}
 
 		/*
@@ -463,6 +495,7 @@ namespace ImGui
 
 			// Update caches for next frame
 			AlignSetVec2(St, Base, item_tag, measured);
+			AlignTouchVec2(Base, item_tag);
 
 			// Track row max height for next frame
 			if (measured.y > MeasuredRowH)
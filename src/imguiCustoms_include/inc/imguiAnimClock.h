@@ -0,0 +1,158 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include <imgui.h>
+#include <imgui_internal.h>
+#include "imguiContextData.h"
+
+// Time base shared by the animated widgets.
+//
+// ImGui::GetTime() is a double, but a float copy of it loses precision as the application keeps running:
+// after 1 day a float only resolves ~8 ms, after 30 days ~250 ms, and animations visibly stutter.
+// Widgets therefore keep absolute times as doubles and only narrow to float after subtracting (elapsed time)
+// or wrapping (phases), where the values are small again.
+//
+// The clock also tracks animation activity: animated widgets report how long they keep moving, so an application
+// can stop rendering while nothing does (see GetAnimIdleTimeout).
+namespace AnimClock
+{
+    // Effects that only need a locally continuous time (noise) get the time wrapped to this period.
+    // A float resolves 0.5 ms at 4096 s; the wrap shows as one jump per period.
+    static const double kWrapPeriod = 4096.0;
+
+    // GetAnimIdleTimeout() when nothing is scheduled: wait for input only
+    static const double kNoDeadline = DBL_MAX;
+
+    // now - since, in seconds
+    static inline float Since(double now, double since)
+    {
+        return (float)(now - since);
+    }
+
+    // (now * rate + offset) wrapped to [0,1), computed in double
+    static inline float Phase(double now, double rate, double offset = 0.0)
+    {
+        const double x = now * rate + offset;
+        return (float)(x - floor(x));
+    }
+
+    // now wrapped to [0, period)
+    static inline float Wrapped(double now, double period = kWrapPeriod)
+    {
+        return (float)(now - floor(now / period) * period);
+    }
+}
+
+namespace ImGui
+{
+    // Current animation time in seconds. Keep it (and anything derived from it, like start times) as a double.
+    inline double GetAnimTime()
+    {
+        return GImGui->Time;
+    }
+
+    // Seconds elapsed since an earlier GetAnimTime()
+    inline float AnimTimeSince(double since)
+    {
+        return AnimClock::Since(GetAnimTime(), since);
+    }
+
+    // ---- Activity ----
+    struct AnimActivity
+    {
+        double ActiveUntil = -1.0;  // every frame up to this time is animated
+        double WakeAt = 0.0;        // earliest time a stepped animation changes next, reported during WakeFrame
+        int    WakeFrame = -1;
+    };
+
+    inline AnimActivity& GetAnimActivity()
+    {
+        static const ImGuiID owner = ImHashStr("##AnimActivity");
+        return *GetContextData<AnimActivity>(owner);
+    }
+
+    // Something animates until time (a GetAnimTime() value): frames are needed until then
+    inline void AnimActiveUntil(double time)
+    {
+        AnimActivity& activity = GetAnimActivity();
+        if (time > activity.ActiveUntil)
+            activity.ActiveUntil = time;
+    }
+
+    // Something keeps animating: the next frame is needed too
+    inline void AnimActiveNextFrame()
+    {
+        AnimActiveUntil(GetAnimTime());
+    }
+
+    // Something steps at time and is still until then (e.g. a flipbook): one frame is needed at that time.
+    // Report it every frame the animation is drawn.
+    inline void AnimWakeAt(double time)
+    {
+        ImGuiContext& g = *GImGui;
+        AnimActivity& activity = GetAnimActivity();
+        if (activity.WakeFrame != g.FrameCount || time < activity.WakeAt)
+        {
+            activity.WakeAt = time;
+            activity.WakeFrame = g.FrameCount;
+        }
+    }
+
+    // After a frame: seconds the application can wait for input before the next frame is needed.
+    // 0 while something animates, AnimClock::kNoDeadline when nothing is scheduled.
+    inline double GetAnimIdleTimeout()
+    {
+        ImGuiContext& g = *GImGui;
+        const AnimActivity& activity = GetAnimActivity();
+        const double now = GetAnimTime();
+        if (activity.ActiveUntil >= now)
+            return 0.0;
+        if (activity.WakeFrame == g.FrameCount)
+            return ImMax(activity.WakeAt - now, 0.0);
+        return AnimClock::kNoDeadline;
+    }
+
+    // (time * rate + offset) wrapped to [0,1), e.g. AnimPhase(1.0 / period) for something that loops every period seconds.
+    // Asking for a phase means something loops, so the frame is reported as animated.
+    inline float AnimPhase(double rate, double offset = 0.0)
+    {
+        AnimActiveNextFrame();
+        return AnimClock::Phase(GetAnimTime(), rate, offset);
+    }
+
+    // Time wrapped to [0, period), for effects that need a small continuous time but no exact period (see AnimClock::kWrapPeriod).
+    // Reports the frame as animated, like AnimPhase.
+    inline float AnimTimeWrapped(double period = AnimClock::kWrapPeriod)
+    {
+        AnimActiveNextFrame();
+        return AnimClock::Wrapped(GetAnimTime(), period);
+    }
+
+    // ImGuiStorage only keeps 32-bit values, so times are stored as two ints: the low half at key, the high half at this key.
+    inline ImGuiID StorageTimeKeyHi(ImGuiID key)
+    {
+        return ImHashData(&key, sizeof(key), 0x71AE);
+    }
+
+    inline void StorageSetTime(ImGuiStorage* storage, ImGuiID key, double time)
+    {
+        uint64_t bits;
+        memcpy(&bits, &time, sizeof(bits));
+        storage->SetInt(key, (int)(uint32_t)bits);
+        storage->SetInt(StorageTimeKeyHi(key), (int)(uint32_t)(bits >> 32));
+    }
+
+    inline double StorageGetTime(ImGuiStorage* storage, ImGuiID key, double default_time)
+    {
+        const int absent = 0x7FF8DEAD; // a NaN high half, never written for a real time
+        const int hi = storage->GetInt(StorageTimeKeyHi(key), absent);
+        if (hi == absent)
+            return default_time;
+        const uint64_t bits = ((uint64_t)(uint32_t)hi << 32) | (uint32_t)storage->GetInt(key, 0);
+        double time;
+        memcpy(&time, &bits, sizeof(time));
+        return time;
+    }
+}
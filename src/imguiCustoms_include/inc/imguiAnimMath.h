@@ -0,0 +1,101 @@
+#pragma once
+#include <stdint.h>
+#include <math.h>
+
+// Cheap math shared by the animated widgets. None of it needs to be exact: results are pixel offsets and colors.
+//
+// Error bounds (measured against double precision sin/cos):
+//   fast_sin / fast_cos  max abs error 4e-6 for |x| <= pi, 1e-4 for |x| <= 1e3, 1.3e-3 for |x| <= 1e4, 8e-3 for |x| <= 1e5.
+//                        Past pi the error comes from the float range reduction, not the polynomial: keep phases small,
+//                        e.g. by wrapping time with fast_fract before scaling it to radians.
+//   ValueNoise1D_x8      bit-identical to ValueNoise1D for every lane.
+namespace AnimMath
+{
+    // Odd polynomial for sin(a) on [-pi/2, pi/2] (Taylor to a^9), max abs error ~4e-6 on the interval
+    static const float kInvTwoPi = 0.15915494309f;
+    static const float kTwoPi = 6.28318530718f;
+    static const float kSinC3 = -1.0f / 6.0f, kSinC5 = 1.0f / 120.0f, kSinC7 = -1.0f / 5040.0f, kSinC9 = 1.0f / 362880.0f;
+
+    // x - floor(x), in [0,1). Unlike fmodf it wraps negative values the same way as positive ones.
+    static inline float fast_fract(float x)
+    {
+        return x - floorf(x);
+    }
+
+    static inline float fast_sin(float x)
+    {
+        // Reduce to r in [-0.5, 0.5] turns, then fold to [-0.25, 0.25] with sin(pi - a) = sin(a).
+        // Same steps as the SIMD sines in imguiAnimTextKernels.h, so scalar and vector paths agree.
+        float r = x * kInvTwoPi;
+        r -= floorf(r + 0.5f);
+        r = (r < 0.5f - r) ? r : 0.5f - r;
+        r = (r > -0.5f - r) ? r : -0.5f - r;
+        const float a = r * kTwoPi;
+        const float a2 = a * a;
+        float p = kSinC7 + a2 * kSinC9;
+        p = kSinC5 + a2 * p;
+        p = kSinC3 + a2 * p;
+        p = 1.0f + a2 * p;
+        return a * p;
+    }
+
+    static inline float fast_cos(float x)
+    {
+        return fast_sin(x + 1.57079632679f);
+    }
+
+    // Tiny stable hash -> [0,1)
+    static inline float Hash01(uint32_t x)
+    {
+        x ^= x * 0x27d4eb2d;
+        x ^= x >> 15; x *= 0x85ebca6b; x ^= x >> 13; x *= 0xc2b2ae35; x ^= x >> 16;
+        return (x & 0x00FFFFFF) * (1.0f / 16777216.0f);
+    }
+
+    // Per call part of ValueNoise1D: the sample index k and interpolation weight w only depend on time,
+    // so every seed only has to hash its two lattice points.
+    static inline void NoiseStep(float t, float speed, float roughness, uint32_t* out_k, float* out_w)
+    {
+        float u = t * speed;
+        float k = floorf(u);
+        float f = u - k;
+        float s = f * f * (3.0f - 2.0f * f);
+        *out_k = (uint32_t)(int64_t)k; // through a signed type: k is negative for negative speeds
+        *out_w = (roughness <= 0.0f) ? f : (roughness >= 1.0f ? s : ((1.0f - roughness) * f + roughness * s));
+    }
+
+    // 1D value noise: random samples per "tick", smooth-interpolated in between.
+    // speed = "hops per second". roughness in [0..1]: 0 = linear, 1 = smoothstep.
+    static inline float ValueNoise1D(uint32_t seed, float t, float speed, float roughness = 1.0f)
+    {
+        uint32_t k; float w;
+        NoiseStep(t, speed, roughness, &k, &w);
+        const float a = Hash01(seed + k);
+        const float b = Hash01(seed + k + 1u);
+        return a + (b - a) * w; // 0..1
+    }
+
+    // ValueNoise1D of 8 seeds at the same time. The time dependent part is computed once and the lanes are
+    // branch-free integer hashes, which compilers turn into SIMD (8 lanes with AVX2, 2x4 with SSE4.1/NEON).
+    static inline void ValueNoise1D_x8(const uint32_t* seeds, float t, float speed, float roughness, float* out)
+    {
+        uint32_t k; float w;
+        NoiseStep(t, speed, roughness, &k, &w);
+        for (int i = 0; i < 8; ++i)
+        {
+            const float a = Hash01(seeds[i] + k);
+            const float b = Hash01(seeds[i] + k + 1u);
+            out[i] = a + (b - a) * w;
+        }
+    }
+
+    // Any number of seeds, in blocks of 8
+    static inline void ValueNoise1D_N(const uint32_t* seeds, int count, float t, float speed, float roughness, float* out)
+    {
+        int i = 0;
+        for (; i + 8 <= count; i += 8)
+            ValueNoise1D_x8(seeds + i, t, speed, roughness, out + i);
+        for (; i < count; ++i)
+            out[i] = ValueNoise1D(seeds[i], t, speed, roughness);
+    }
+}
@@ -2,114 +2,421 @@
 #include <string>
 #include <imgui.h>
 #include <imgui_internal.h>
+#include "imguiContextData.h"
+#include "imguiGradientLut.h"
+#include "imguiAnimClock.h"
+#include "imguiAnimTextKernels.h"
 
 namespace AnimHelpers
 {
     // 1D value noise: random samples per "tick", smooth-interpolated in between.
     // speed = "hops per second". roughness in [0..1]: 0 = linear, 1 = smoothstep. (>1 makes it even smoother)
+    // See AnimMath::ValueNoise1D_x8 to evaluate many seeds at once.
     static inline float ValueNoise1D(uint32_t seed, float t, float speed, float roughness = 1.0f) {
-        // Tiny stable hash -> [0,1)
-        auto Hash01 = [&](uint32_t x) {
-            x ^= x * 0x27d4eb2d;
-            x ^= x >> 15; x *= 0x85ebca6b; x ^= x >> 13; x *= 0xc2b2ae35; x ^= x >> 16;
-            return (x & 0x00FFFFFF) * (1.0f / 16777216.0f);
-            };
-
-        float u = t * speed;
-        float k = floorf(u);
-        float f = u - k;
-        float a = Hash01(seed + (uint32_t)k);
-        float b = Hash01(seed + (uint32_t)k + 1u);
-        // smoother interpolation if roughness>0
-        float w = (roughness <= 0.0f) ? f : (roughness >= 1.0f ? (f * f * (3.0f - 2.0f * f))  // smoothstep
-            : ((1.0f - roughness) * f + roughness * (f * f * (3.0f - 2.0f * f))));
-        return a + (b - a) * w; // 0..1
+        return AnimMath::ValueNoise1D(seed, t, speed, roughness);
     }
 
-    // --- helpers ---
-    static inline ImU32 LerpRGBA(ImU32 a, ImU32 b, float t)
+    // Un-animated glyph geometry of a text, as AddText would emit it at (0,0). Indices start at 0.
+    struct GlyphVtxTemplate
     {
-        ImVec4 ca = ImGui::ColorConvertU32ToFloat4(a);
-        ImVec4 cb = ImGui::ColorConvertU32ToFloat4(b);
-        ImVec4 cc = ImLerp(ca, cb, ImClamp(t, 0.0f, 1.0f));
-        return ImGui::ColorConvertFloat4ToU32(cc);
+        ImU64   text_hash = 0;
+        ImFont* font = nullptr;
+        float   font_size = 0.0f;
+        ImU32   col = 0;
+        ImFontBaked* baked = nullptr;   // baked size the glyphs came from
+        int     tex_uid = 0;            // atlas texture UniqueID when built, changes when the texture is recreated
+        ImVec2  uv_scale;               // atlas TexUvScale when built, changes when the atlas texture is resized
+        float   wrap_width = 0.0f;      // 0 = single line per '\n'
+        ImVec2  text_size;              // CalcTextSize() of the text when built
+        float   min_x = 0.0f;           // horizontal span of the vertices
+        float   max_x = 0.0f;
+        ImVector<ImDrawVert> vtx;
+        ImVector<ImDrawIdx>  idx;
+    };
+
+    struct AnimTextCache
+    {
+        ImGui::IDLruCache<GlyphVtxTemplate> Templates;
+        ImDrawList* Scratch = nullptr;  // private draw list the templates are built in
+        ImVector<ImU32> SeedsX, SeedsY; // per glyph noise seeds of the last AddTextShaky call
+        ImGuiID NextID = 0;             // set by ImGui::SetNextAnimTextID, consumed by the next animated text
+
+        ~AnimTextCache() { if (Scratch) IM_DELETE(Scratch); }
+    };
+
+    static int ANIM_TEXT_CACHE_CAPACITY = 256; // modify this (before first use) to change how many text templates each context keeps
+
+    static inline AnimTextCache& GetAnimTextCache()
+    {
+        static const ImGuiID owner = ImHashStr("##AnimTextCache");
+        AnimTextCache* cache = ImGui::GetContextData<AnimTextCache>(owner);
+        if (cache->Templates.Capacity() == 0)
+        {
+            cache->Templates.Init(ANIM_TEXT_CACHE_CAPACITY);
+            cache->Scratch = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+        }
+        return *cache;
     }
 
-    static inline ImU32 LerpHSV(ImU32 a, ImU32 b, float t)
+    // Template slot of the next animated text: the id passed to ImGui::SetNextAnimTextID, else the text itself, mixed with
+    // the color and wrap width so that identical labels drawn differently in one window don't fight over one slot.
+    static inline ImGuiID TextTemplateKey(const char* text, ImU32 col, float wrap_width)
     {
-        auto u32_to_hsva = [](ImU32 c, float& h, float& s, float& v, float& a_out) {
-            ImVec4 cf = ImGui::ColorConvertU32ToFloat4(c);
-            ImGui::ColorConvertRGBtoHSV(cf.x, cf.y, cf.z, h, s, v);
-            a_out = cf.w;
-            };
-        float h1, s1, v1, a1, h2, s2, v2, a2;
-        u32_to_hsva(a, h1, s1, v1, a1);
-        u32_to_hsva(b, h2, s2, v2, a2);
-        // Shortest hue interpolation
-        float dh = h2 - h1;
-        if (dh > 0.5f)  dh -= 1.0f;
-        if (dh < -0.5f) dh += 1.0f;
-        float h = h1 + dh * t;
-        if (h < 0.0f) h += 1.0f;
-        if (h > 1.0f) h -= 1.0f;
-        float s = ImLerp(s1, s2, t);
-        float v = ImLerp(v1, v2, t);
-        float alpha = ImLerp(a1, a2, t);
-        ImVec4 rgb; ImGui::ColorConvertHSVtoRGB(h, s, v, rgb.x, rgb.y, rgb.z); rgb.w = alpha;
-        return ImGui::ColorConvertFloat4ToU32(rgb);
+        AnimTextCache& cache = GetAnimTextCache();
+        ImGuiID id = cache.NextID;
+        cache.NextID = 0;
+        if (id == 0)
+            id = ImGui::GetCurrentWindow()->GetID(text);
+        id = ImHashData(&col, sizeof(col), id);
+        id = ImHashData(&wrap_width, sizeof(wrap_width), id);
+        return id;
     }
 
-    static inline ImU32 SampleStops(const ImU32* stops, int count, float u, bool use_hsv)
+    // Returns the glyph template of [text, text_end) for the current font, (re)building it only when the text, font, size,
+    // color, wrap width, baked font or atlas texture changed. After the first frame, drawing a static text costs no font layout at all.
+    static inline const GlyphVtxTemplate& GetTextTemplate(ImGuiID id, const char* text, const char* text_end, ImU32 col,
+        float wrap_width = 0.0f)
     {
-        if (count <= 0) return IM_COL32_WHITE;
-        if (count == 1) return stops[0];
-
-        // u in [0,1] across the gradient; supports repeating if caller wraps it.
-        u = ImClamp(u, 0.0f, 1.0f);
-        float x = u * (count - 1);
-        int i = (int)floorf(x);
-        if (i >= count - 1) return stops[count - 1];
-        float t = x - i;
-        return use_hsv ? LerpHSV(stops[i], stops[i + 1], t)
-            : LerpRGBA(stops[i], stops[i + 1], t);
+        ImGuiContext& g = *GImGui;
+        AnimTextCache& cache = GetAnimTextCache();
+        bool created = false;
+        GlyphVtxTemplate& tpl = cache.Templates.Get(id, &created);
+
+        const ImU64 hash = ImGui::TextHash64(text, text_end);
+        ImFontAtlas* atlas = g.Font->ContainerAtlas;
+        const int tex_uid = atlas->TexData ? atlas->TexData->UniqueID : 0;
+        const bool stale =
+            created ||
+            tpl.text_hash != hash ||
+            tpl.font != g.Font ||
+            tpl.font_size != g.FontSize ||
+            tpl.baked != g.FontBaked ||
+            tpl.tex_uid != tex_uid ||
+            tpl.col != col ||
+            tpl.wrap_width != wrap_width ||
+            tpl.uv_scale.x != atlas->TexUvScale.x || tpl.uv_scale.y != atlas->TexUvScale.y;
+        if (!stale)
+            return tpl;
+
+        ImDrawList* dl = cache.Scratch;
+        dl->_ResetForNewFrame();
+        dl->PushClipRectFullScreen();
+        dl->PushTexture(atlas->TexRef);
+        const ImVec4 no_clip(-FLT_MAX, -FLT_MAX, FLT_MAX, FLT_MAX);
+        dl->AddText(g.Font, g.FontSize, ImVec2(0.0f, 0.0f), col, text, text_end, wrap_width, &no_clip);
+        dl->PopTexture();
+
+        tpl.text_hash = hash;
+        tpl.font = g.Font;
+        tpl.font_size = g.FontSize;
+        tpl.col = col;
+        tpl.baked = g.FontBaked;
+        tpl.tex_uid = atlas->TexData ? atlas->TexData->UniqueID : 0; // read after AddText, which may have added glyphs to the atlas
+        tpl.uv_scale = atlas->TexUvScale;
+        tpl.wrap_width = wrap_width;
+        tpl.text_size = ImGui::CalcTextSize(text, text_end, false, wrap_width > 0.0f ? wrap_width : -1.0f);
+        tpl.vtx.resize(dl->VtxBuffer.Size);
+        tpl.idx.resize(dl->IdxBuffer.Size);
+        if (dl->VtxBuffer.Size > 0)
+            memcpy(tpl.vtx.Data, dl->VtxBuffer.Data, (size_t)dl->VtxBuffer.Size * sizeof(ImDrawVert));
+        if (dl->IdxBuffer.Size > 0)
+            memcpy(tpl.idx.Data, dl->IdxBuffer.Data, (size_t)dl->IdxBuffer.Size * sizeof(ImDrawIdx));
+
+        tpl.min_x = FLT_MAX; tpl.max_x = -FLT_MAX;
+        for (const ImDrawVert& v : tpl.vtx)
+        {
+            if (v.pos.x < tpl.min_x) tpl.min_x = v.pos.x;
+            if (v.pos.x > tpl.max_x) tpl.max_x = v.pos.x;
+        }
+        if (tpl.vtx.empty())
+            tpl.min_x = tpl.max_x = 0.0f;
+        return tpl;
+    }
+
+    // Size of the text as its cached template laid it out, so visible animated texts skip CalcTextSize after the first frame.
+    // Falls back to CalcTextSize when there is no up to date template (yet), without building one.
+    static inline ImVec2 CalcTemplateTextSize(ImGuiID id, const char* text, const char* text_end, float wrap_width = 0.0f)
+    {
+        ImGuiContext& g = *GImGui;
+        const GlyphVtxTemplate* tpl = GetAnimTextCache().Templates.Peek(id);
+        if (tpl && tpl->font == g.Font && tpl->font_size == g.FontSize && tpl->baked == g.FontBaked && tpl->wrap_width == wrap_width &&
+            tpl->text_hash == ImGui::TextHash64(text, text_end))
+            return tpl->text_size;
+        return ImGui::CalcTextSize(text, text_end, false, wrap_width > 0.0f ? wrap_width : -1.0f);
+    }
+
+    // Number of glyph quads AddText emits for [text, text_end) with the current font, i.e. the vtx.Size / 4 of its template,
+    // counted without laying the text out. Line breaks and invisible glyphs (blanks) emit no quad.
+    static inline int CountTextGlyphs(const char* text, const char* text_end)
+    {
+        ImFontBaked* baked = ImGui::GetFontBaked();
+        int count = 0;
+        for (const char* s = text; s < text_end; )
+        {
+            unsigned int c = (unsigned char)*s;
+            if (c < 0x80)
+                s += 1;
+            else
+                s += ImTextCharFromUtf8(&c, s, text_end);
+            if (c == '\n' || c == '\r')
+                continue;
+            const ImFontGlyph* glyph = baked->FindGlyph((ImWchar)c);
+            if (glyph && glyph->Visible)
+                count++;
+        }
+        return count;
+    }
+
+    // Lays out an animated text box of the given size at the cursor and registers it as an item.
+    // Returns false when it is clipped: the caller then skips glyph emission and all per-vertex work.
+    static inline bool AnimTextItemAdd(const ImVec2& size)
+    {
+        ImGuiWindow* window = ImGui::GetCurrentWindow();
+        const ImRect bb(window->DC.CursorPos, window->DC.CursorPos + size);
+        ImGui::ItemSize(size);
+        return ImGui::ItemAdd(bb, 0);
+    }
+
+    // Copies a template into dl and returns its first vertex. Positions are still relative to the text origin:
+    // the caller adds the origin in the same loop that applies its animated transform.
+    static inline ImDrawVert* PrimTemplate(ImDrawList* dl, const GlyphVtxTemplate& tpl)
+    {
+        const int vtx_count = tpl.vtx.Size;
+        const int idx_count = tpl.idx.Size;
+        dl->PrimReserve(idx_count, vtx_count);
+        ImDrawVert* vtx = dl->_VtxWritePtr;
+        ImDrawIdx* idx = dl->_IdxWritePtr;
+        const ImDrawIdx base = (ImDrawIdx)dl->_VtxCurrentIdx;
+        memcpy(vtx, tpl.vtx.Data, (size_t)vtx_count * sizeof(ImDrawVert));
+        for (int i = 0; i < idx_count; ++i)
+            idx[i] = (ImDrawIdx)(tpl.idx.Data[i] + base);
+        dl->_VtxWritePtr += vtx_count;
+        dl->_IdxWritePtr += idx_count;
+        dl->_VtxCurrentIdx += (unsigned int)vtx_count;
+        return vtx;
+    }
+
+    // Draws text with every glyph displaced by its own value noise (see TextShaky).
+    // One pass over the string: glyphs are looked up directly in the baked font and their quads written into space
+    // reserved up front, instead of an AddText + CalcTextSizeA call per character. The noise of all glyphs is then
+    // evaluated together by the NoiseDisplaceQuads kernel.
+    static inline void AddTextShaky(ImDrawList* dl, ImFont* font, float size, const ImVec2& pos, ImU32 col,
+        const char* text, const char* text_end,
+        float spread_x, float spread_y, float speed, float chaos, float roughness,
+        float t, float line_advance)
+    {
+        if (text == text_end || (col & IM_COL32_A_MASK) == 0)
+            return;
+
+        ImFontBaked* baked = font->GetFontBaked(size);
+        const float scale = size / baked->Size;
+        const ImU32 col_untinted = col | ~IM_COL32_A_MASK; // colored glyphs (e.g. emoji) only take the alpha
+        AnimTextCache& cache = GetAnimTextCache();
+        cache.SeedsX.resize(0);
+        cache.SeedsY.resize(0);
+
+        // Worst case is one quad per byte, the unused part is given back at the end
+        const int vtx_max = (int)(text_end - text) * 4;
+        const int idx_max = (int)(text_end - text) * 6;
+        dl->PrimReserve(idx_max, vtx_max);
+        ImDrawVert* vtx_write = dl->_VtxWritePtr;
+        ImDrawIdx* idx_write = dl->_IdxWritePtr;
+        unsigned int vtx_index = dl->_VtxCurrentIdx;
+
+        ImVec2 pen = pos;
+        const char* p = text;
+        unsigned int cp = 0;
+        int i = 0;
+        while (p < text_end)
+        {
+            cp = (unsigned int)(unsigned char)*p;
+            if (cp < 0x80)
+                p += 1;
+            else
+                p += ImTextCharFromUtf8(&cp, p, text_end);
+
+            if (cp == '\n') {
+                pen.x = pos.x;
+                pen.y += line_advance;
+                continue;
+            }
+            if (cp == '\r')
+                continue;
+
+            const ImFontGlyph* glyph = baked->FindGlyph((ImWchar)cp);
+            if (glyph == nullptr)
+                continue;
+
+            if (glyph->Visible)
+            {
+                // Per-character seeds (desync neighbors; chaos scales the seed spacing)
+                uint32_t sx = (uint32_t)(0x9E3779B9u * (i + 17)) ^ (uint32_t)cp;
+                uint32_t sy = (uint32_t)(0x85EBCA6Bu * (i + 31)) ^ ((uint32_t)cp * 0xC2B2AE35u);
+                cache.SeedsX.push_back(sx + (uint32_t)(int32_t)(chaos * 997.0f));
+                cache.SeedsY.push_back(sy + (uint32_t)(int32_t)(chaos * 1511.0f));
+
+                // Snap the pen like AddText does, the jitter added by the kernel is whole pixels so glyphs stay crisp
+                const float x = ImTrunc(pen.x);
+                const float y = ImTrunc(pen.y);
+                const float x1 = x + glyph->X0 * scale, x2 = x + glyph->X1 * scale;
+                const float y1 = y + glyph->Y0 * scale, y2 = y + glyph->Y1 * scale;
+                const ImU32 glyph_col = glyph->Colored ? col_untinted : col;
+
+                idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
+                idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
+                vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = glyph->U0; vtx_write[0].uv.y = glyph->V0;
+                vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = glyph->U1; vtx_write[1].uv.y = glyph->V0;
+                vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = glyph->U1; vtx_write[2].uv.y = glyph->V1;
+                vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = glyph->U0; vtx_write[3].uv.y = glyph->V1;
+                vtx_write += 4;
+                vtx_index += 4;
+                idx_write += 6;
+            }
+
+            pen.x += glyph->AdvanceX * scale;
+            ++i;
+        }
+
+        // Value noise in [-1,1] per glyph, scaled by spread
+        AnimKernels::Get().NoiseDisplaceQuads(dl->_VtxWritePtr, cache.SeedsX.Size, cache.SeedsX.Data, cache.SeedsY.Data,
+            t, speed, speed * 1.13f, roughness, ImVec2(spread_x, spread_y));
+
+        dl->PrimUnreserve(idx_max - (int)(idx_write - dl->_IdxWritePtr), vtx_max - (int)(vtx_write - dl->_VtxWritePtr));
+        dl->_VtxWritePtr = vtx_write;
+        dl->_IdxWritePtr = idx_write;
+        dl->_VtxCurrentIdx = vtx_index;
+    }
+
+    // Measured layout of a TextMarqueeMultiple text list. Rebuilt only when the list, font or gap changes.
+    struct MarqueeLayout
+    {
+        ImU64   list_hash = 0;
+        ImFont* font = nullptr;
+        float   font_size = 0.0f;
+        float   gap = 0.0f;
+        float   max_text_h = 0.0f;
+        float   pattern_w = 0.0f;       // continuous mode: total width of [text0][gap]...[textN-1][gap]
+        ImVector<float> widths;
+        ImVector<float> starts;         // prefix offsets of the texts in the continuous pattern
+    };
+
+    struct MarqueeCache
+    {
+        ImGui::IDLruCache<MarqueeLayout> Layouts;
+        ImVector<const char*> CStrs;    // scratch for the std::vector<std::string> overload
+    };
+
+    static int ANIM_MARQUEE_CACHE_CAPACITY = 64; // modify this (before first use) to change how many marquee layouts each context keeps
+
+    static inline MarqueeCache& GetMarqueeCache()
+    {
+        static const ImGuiID owner = ImHashStr("##MarqueeCache");
+        MarqueeCache* cache = ImGui::GetContextData<MarqueeCache>(owner);
+        if (cache->Layouts.Capacity() == 0)
+            cache->Layouts.Init(ANIM_MARQUEE_CACHE_CAPACITY);
+        return *cache;
+    }
+
+    static inline ImU64 TextListHash64(const char* const* texts, int text_count)
+    {
+        ImU64 h = 0xcbf29ce484222325ULL ^ (ImU64)text_count;
+        for (int i = 0; i < text_count; ++i)
+        {
+            const char* t = texts[i] ? texts[i] : "";
+            h = (h ^ ImGui::TextHash64(t, t + strlen(t))) * 0x100000001b3ULL;
+        }
+        return h;
+    }
+
+    // Returns the layout of texts for the current font, measuring the texts only when the list changed.
+    static inline const MarqueeLayout& GetMarqueeLayout(ImGuiID id, const char* const* texts, int text_count, float gap)
+    {
+        ImGuiContext& g = *GImGui;
+        bool created = false;
+        MarqueeLayout& layout = GetMarqueeCache().Layouts.Get(id, &created);
+        const ImU64 hash = TextListHash64(texts, text_count);
+        const bool remeasure = created || layout.list_hash != hash || layout.font != g.Font || layout.font_size != g.FontSize;
+        if (remeasure)
+        {
+            layout.list_hash = hash;
+            layout.font = g.Font;
+            layout.font_size = g.FontSize;
+            layout.widths.resize(text_count);
+            layout.max_text_h = 0.0f;
+            for (int i = 0; i < text_count; ++i)
+            {
+                const char* t = texts[i] ? texts[i] : "";
+                ImVec2 sz = ImGui::CalcTextSize(t, nullptr, false);
+                layout.widths[i] = ImMax(sz.x, 1.0f); // avoid degenerate width
+                layout.max_text_h = ImMax(layout.max_text_h, sz.y);
+            }
+            if (layout.max_text_h <= 0.0f)
+                layout.max_text_h = 1.0f;
+        }
+        if (remeasure || layout.gap != gap || layout.starts.Size != text_count)
+        {
+            layout.gap = gap;
+            layout.starts.resize(text_count);
+            float pattern_w = 0.0f;
+            for (int i = 0; i < text_count; ++i)
+            {
+                layout.starts[i] = pattern_w;
+                pattern_w += layout.widths[i] + ImMax(gap, 0.0f);
+            }
+            layout.pattern_w = ImMax(pattern_w, 1.0f);
+        }
+        return layout;
     }
 }
 
 // ImGui namespace access for convenience
 namespace ImGui
 {
+    // Gives the next TextWobble/TextGradient*/TextEffects/TextTypewriter call a stable cache slot. By default the slot comes
+    // from the text itself, so a text that changes every frame (counters, timers) would take a new slot every frame.
+    inline void SetNextAnimTextID(const char* str_id)
+    {
+        AnimHelpers::GetAnimTextCache().NextID = ImGui::GetID(str_id);
+    }
+
 	// Wobbling text effect using sine waves.
     // amp: vertical wobble in pixels (also used as vertical padding)
     // freq: waves across the whole string
     // speed: cycles per second
     inline void TextWobble(const char* text, float amp = 3.0f, float freq = 1.5f, float speed = 1.0f, ImU32 col = IM_COL32_WHITE)
     {
-        ImDrawList* dl = ImGui::GetWindowDrawList();
+        ImGuiWindow* window = ImGui::GetCurrentWindow();
+        const ImGuiID id = AnimHelpers::TextTemplateKey(text, col, 0.0f); // before SkipItems so SetNextAnimTextID never leaks
+        if (window->SkipItems)
+            return;
 
         // Reserve layout so following items wont overlap
-        const ImVec2 top_left = ImGui::GetCursorScreenPos();
-        const ImVec2 text_size = ImGui::CalcTextSize(text);          // single-line
+        const char* text_end = text + strlen(text);
+        const ImVec2 top_left = window->DC.CursorPos;
+        const ImVec2 text_size = AnimHelpers::CalcTemplateTextSize(id, text, text_end); // single-line
         const float  pad_top = amp;                                 // how far wobble can go upward
         const float  pad_bottom = amp;                              // how far wobble can go downward
-        ImGui::Dummy(ImVec2(text_size.x, text_size.y + pad_top + pad_bottom));
+        if (!AnimHelpers::AnimTextItemAdd(ImVec2(text_size.x, text_size.y + pad_top + pad_bottom)))
+            return; // clipped: no glyphs, no vertex work
 
         // Draw baseline at the padded position (so wobble stays within the reserved box)
         ImVec2 draw_pos = ImVec2(top_left.x, top_left.y + pad_top);
-        const int vtx0 = dl->VtxBuffer.Size;
-        dl->AddText(draw_pos, col, text);
+        const AnimHelpers::GlyphVtxTemplate& tpl = AnimHelpers::GetTextTemplate(id, text, text_end, col);
+        if (tpl.vtx.empty())
+            return;
+
+        ImDrawList* dl = window->DrawList;
+        dl->PushTexture(ImGui::GetFont()->ContainerAtlas->TexRef);
+        ImDrawVert* vtx = AnimHelpers::PrimTemplate(dl, tpl);
+        dl->PopTexture();
 
 		// Modify vertices to create wobble effect
-        const float t = (float)ImGui::GetTime();
 		const float two_pi = 6.28319f; // approx 2*PI, i don't really care about precision here
         const float wavelength = (text_size.x > 0.0f) ? (two_pi * freq / text_size.x) : 0.0f;
-        const float temporal = two_pi * speed * t;
-		// Iterate vertices of the last added text
-        for (int i = vtx0; i < dl->VtxBuffer.Size; ++i)
-        {
-            ImDrawVert& v = dl->VtxBuffer[i];
-            float spatial = (v.pos.x - draw_pos.x) * wavelength;
-            v.pos.y += amp * sinf(spatial + temporal);
-        }
+        const float temporal = speed != 0.0f ? two_pi * ImGui::AnimPhase(speed) : 0.0f; // wrapped so the fast sine stays accurate
+        const ImVec2 origin = ImTrunc(draw_pos); // AddText snaps the pen the same way
+		// Template positions are relative to the text origin
+        AnimKernels::Get().SineDisplaceY(vtx, tpl.vtx.Size, origin, wavelength, temporal, amp);
     }
 
     // Jittery text where each character moves independently inside a rectangle set by spread.
@@ -122,56 +429,28 @@ namespace ImGui
         float speed = 12.0f, float chaos = 1.0f, float roughness = 0.9f,
         ImU32 col = IM_COL32_WHITE)
     {
+        ImGuiWindow* window = ImGui::GetCurrentWindow();
+        if (window->SkipItems)
+            return;
 
-        ImDrawList* dl = ImGui::GetWindowDrawList();
+        ImDrawList* dl = window->DrawList;
         ImFont* font = ImGui::GetFont();
         float       size = ImGui::GetFontSize();
 
         // Reserve enough vertical space so jitter won't overlap other widgets.
-        ImVec2 top_left = ImGui::GetCursorScreenPos();
+        ImVec2 top_left = window->DC.CursorPos;
         ImVec2 base_sz = ImGui::CalcTextSize(text);
-        ImGui::Dummy(ImVec2(base_sz.x + spread_x * 2.0f, base_sz.y + spread_y * 2.0f));
+        if (!AnimHelpers::AnimTextItemAdd(ImVec2(base_sz.x + spread_x * 2.0f, base_sz.y + spread_y * 2.0f)))
+            return; // clipped: no glyphs, no vertex work
 
         ImVec2 pen = ImVec2(top_left.x + spread_x, top_left.y + spread_y);
 
-        const float t = (float)ImGui::GetTime();
-
-        const char* p = text;
-        unsigned int cp = 0;
-        int i = 0;
-
-        while (*p)
-        {
-            const char* p0 = p;
-            int len = ImTextCharFromUtf8(&cp, p, nullptr);
-            if (len <= 0) break;
-            p += len;
-
-            if (cp == '\n') {
-                pen.x = top_left.x + spread_x;
-                pen.y += ImGui::GetTextLineHeightWithSpacing();
-                continue;
-            }
-
-            // Per-character seeds (desync neighbors; chaos scales the seed spacing)
-            uint32_t sx = (uint32_t)(0x9E3779B9u * (i + 17)) ^ (uint32_t)cp;
-            uint32_t sy = (uint32_t)(0x85EBCA6Bu * (i + 31)) ^ ((uint32_t)cp * 0xC2B2AE35u);
-            sx += (uint32_t)(chaos * 997.0f);
-            sy += (uint32_t)(chaos * 1511.0f);
+        const float t = speed != 0.0f ? ImGui::AnimTimeWrapped() : 0.0f;
 
-            // Value noise in [-1,1], scaled by spread
-            float jx = (AnimHelpers::ValueNoise1D(sx, t, speed, roughness) * 2.0f - 1.0f) * spread_x;
-            float jy = (AnimHelpers::ValueNoise1D(sy, t, speed * 1.13f, roughness) * 2.0f - 1.0f) * spread_y;
-
-            // Draw this character only
-            dl->AddText(font, size, ImVec2(pen.x + jx, pen.y + jy), col, p0, p);
-
-            // Advance by measuring this glyph (no FindGlyph needed)
-            ImVec2 w = font->CalcTextSizeA(size, FLT_MAX, 0.0f, p0, p);
-            pen.x += w.x;
-
-            ++i;
-        }
+        dl->PushTexture(font->ContainerAtlas->TexRef);
+        AnimHelpers::AddTextShaky(dl, font, size, pen, col, text, text + strlen(text),
+            spread_x, spread_y, speed, chaos, roughness, t, ImGui::GetTextLineHeightWithSpacing());
+        dl->PopTexture();
     }
 
 
@@ -183,65 +462,41 @@ namespace ImGui
         bool use_hsv = false,       // interpolate in HSV?
         bool smooth_pingpong_peaks = true)
     {
-        ImDrawList* dl = ImGui::GetWindowDrawList();
-        ImVec2 pos = ImGui::GetCursorScreenPos();
-        ImVec2 size = ImGui::CalcTextSize(text);
+        ImGuiWindow* window = ImGui::GetCurrentWindow();
+        const ImGuiID id = AnimHelpers::TextTemplateKey(text, IM_COL32_WHITE, 0.0f);
+        if (window->SkipItems)
+            return;
 
         // Layout like normal text
-        ImGui::Dummy(size);
+        const char* text_end = text + strlen(text);
+        ImVec2 pos = window->DC.CursorPos;
+        if (!AnimHelpers::AnimTextItemAdd(AnimHelpers::CalcTemplateTextSize(id, text, text_end)))
+            return; // clipped: no glyphs, no vertex work
 
-        const int v0 = dl->VtxBuffer.Size;
-        dl->AddText(pos, IM_COL32_WHITE, text); // color gets overridden
+        const AnimHelpers::GlyphVtxTemplate& tpl = AnimHelpers::GetTextTemplate(id, text, text_end, IM_COL32_WHITE); // color gets overridden
+        if (tpl.vtx.empty())
+            return;
 
-        // Find horizontal span of just emitted vertices
-        float minx = FLT_MAX, maxx = -FLT_MAX;
-        for (int i = v0; i < dl->VtxBuffer.Size; ++i) {
-            float x = dl->VtxBuffer[i].pos.x;
-            if (x < minx) minx = x;
-            if (x > maxx) maxx = x;
-        }
-        float span = ImMax(1.0f, maxx - minx);
+        ImDrawList* dl = window->DrawList;
+        dl->PushTexture(ImGui::GetFont()->ContainerAtlas->TexRef);
+        ImDrawVert* vtx = AnimHelpers::PrimTemplate(dl, tpl);
+        dl->PopTexture();
+
+        // Horizontal span of the vertices is known from the template
+        const ImVec2 origin = ImTrunc(pos);
+        float minx = tpl.min_x;
+        float span = ImMax(1.0f, tpl.max_x - tpl.min_x);
 
         // Phase (animation)
         float phase = phase_offset;
         if (mode != 0 && phase_speed != 0.0f) {
-            float t = (float)ImGui::GetTime();
-            phase += t * phase_speed;  // measured in widths
+            phase += ImGui::AnimPhase(phase_speed);  // measured in widths
         }
 
-        auto wrap_repeat = [](float x) { x -= floorf(x); return x; }; // [0,1)
-        auto wrap_pingpong = [smooth_pingpong_peaks](float x) {
-            float s = x - floorf(x);              // saw in [0,1)
-            float tri = 1.0f - fabsf(2.0f * s - 1); // 0->1->0
-            if (smooth_pingpong_peaks)            // soften corners
-                tri = tri * tri * (3.0f - 2.0f * tri);
-            return tri;                           // still [0,1]
-            };
-
-        // Recolor
-        for (int i = v0; i < dl->VtxBuffer.Size; ++i) {
-            float u = (dl->VtxBuffer[i].pos.x - minx) / span; // 0..1 across text
-            float s = u + phase;
-
-            float tval;
-            if (mode == 0) {
-                tval = ImClamp(u, 0.0f, 1.0f);
-            }
-            else if (mode == 1) {
-                tval = wrap_repeat(s);
-            }
-            else { // PingPong
-                tval = wrap_pingpong(s);
-            }
-
-            // Preserve original alpha of the vertex (multiply final alpha by it)
-            ImU32 c = AnimHelpers::SampleStops(stops, stop_count, tval, use_hsv);
-            ImU32 vcol = dl->VtxBuffer[i].col;
-            float a_vtx = ((vcol >> 24) & 0xFF) / 255.0f;
-            ImVec4 cf = ImGui::ColorConvertU32ToFloat4(c);
-            cf.w *= a_vtx;
-            dl->VtxBuffer[i].col = ImGui::ColorConvertFloat4ToU32(cf);
-        }
+        // Recolor from the baked gradient (and move the template to its position)
+        const ImGui::GradientLut& lut = ImGui::GetGradientLut(stops, stop_count, use_hsv);
+        AnimKernels::Get().GradientLutRecolor(vtx, tpl.vtx.Size, origin, lut.Colors.Data, lut.Size(),
+            1.0f / span, -minx / span, phase, mode, smooth_pingpong_peaks);
     }
 
 	// Displays text with a color gradient applied.
@@ -256,10 +511,255 @@ namespace ImGui
         TextGradientEx(text, stops, stop_count, (pingpong ? 2 : 1), phase_speed, phase_offset);
 	}
 
+    // Per glyph callback of a TextEffect, called once every effect stage but the uniform Fade() has been applied to the glyph.
+    // quad: the 4 vertices of the glyph, already in screen space (top-left, top-right, bottom-right, bottom-left).
+    // t: animation time wrapped to AnimClock::kWrapPeriod.
+    typedef void (*TextEffectGlyphCallback)(ImDrawVert* quad, int glyph_index, int glyph_count, float t, void* user_data);
+
+    // Stackable text effects, built with chained calls and drawn with TextEffects():
+    //   ImGui::TextEffects("Hello", ImGui::TextEffect().Wobble(3.0f).Shake(1.0f, 1.0f).Gradient(stops, 3, 2).Reveal(p));
+    // Whatever the number of stages, the text is laid out once (its glyph template is cached like TextWobble's)
+    // and every vertex is read and written once. Per vertex, stages run in a fixed order:
+    // position (wobble, shake) -> color (tint or gradient) -> reveal / alpha -> callback.
+    struct TextEffect
+    {
+        // Position
+        float        WobbleAmp = 0.0f;          // 0 = off
+        float        WobbleFreq = 1.5f;         // waves across the whole string
+        float        WobbleSpeed = 1.0f;        // cycles per second
+        ImVec2       ShakeSpread = ImVec2(0.0f, 0.0f); // (0,0) = off
+        float        ShakeSpeed = 12.0f;
+        float        ShakeChaos = 1.0f;
+        float        ShakeRoughness = 0.9f;
+
+        // Color
+        ImU32        Col = IM_COL32_WHITE;      // tint when there is no gradient
+        const ImU32* GradientStops = nullptr;   // must outlive the TextEffects() call
+        int          GradientStopCount = 0;
+        int          GradientMode = 0;          // 0 == none, 1 == repeat, 2 == pingpong
+        float        GradientSpeed = 0.5f;      // widths per second
+        float        GradientOffset = 0.0f;
+        bool         GradientHsv = false;
+        bool         GradientSmoothPeaks = true;
+
+        // Layout
+        float        WrapWidth = 0.0f;          // 0 = no wrapping, < 0 = wrap at the end of the content region
+
+        // Reveal
+        float        RevealProgress = -1.0f;    // [0,1] across all glyphs, < 0 = off
+        float        RevealGlyphs = -1.0f;      // glyphs shown (fractional = partially faded in), < 0 = off
+        float        RevealFade = 1.0f;         // glyphs over which the reveal edge fades in
+        float        Alpha = 1.0f;
+
+        TextEffectGlyphCallback Callback = nullptr;
+        void*        CallbackUserData = nullptr;
+
+        TextEffect& Color(ImU32 col) { Col = col; return *this; }
+        TextEffect& Wobble(float amp = 3.0f, float freq = 1.5f, float speed = 1.0f)
+        {
+            WobbleAmp = amp; WobbleFreq = freq; WobbleSpeed = speed; return *this;
+        }
+        TextEffect& Shake(float spread_x = 1.5f, float spread_y = 3.0f, float speed = 12.0f, float chaos = 1.0f, float roughness = 0.9f)
+        {
+            ShakeSpread = ImVec2(spread_x, spread_y); ShakeSpeed = speed; ShakeChaos = chaos; ShakeRoughness = roughness; return *this;
+        }
+        TextEffect& Gradient(const ImU32* stops, int stop_count, int mode = 0, float speed = 0.5f, float offset = 0.0f,
+            bool use_hsv = false, bool smooth_pingpong_peaks = true)
+        {
+            GradientStops = stops; GradientStopCount = stop_count; GradientMode = mode; GradientSpeed = speed;
+            GradientOffset = offset; GradientHsv = use_hsv; GradientSmoothPeaks = smooth_pingpong_peaks; return *this;
+        }
+        // progress in [0,1] across all glyphs
+        TextEffect& Reveal(float progress, float fade_glyphs = 1.0f) { RevealProgress = ImSaturate(progress); RevealGlyphs = -1.0f; RevealFade = fade_glyphs; return *this; }
+        // count in glyphs, e.g. chars_per_second * elapsed
+        TextEffect& RevealCount(float glyphs, float fade_glyphs = 1.0f) { RevealGlyphs = ImMax(glyphs, 0.0f); RevealProgress = -1.0f; RevealFade = fade_glyphs; return *this; }
+        TextEffect& Fade(float alpha) { Alpha = alpha; return *this; }
+        TextEffect& Wrap(float wrap_width = -1.0f) { WrapWidth = wrap_width; return *this; }
+        TextEffect& OnGlyph(TextEffectGlyphCallback callback, void* user_data = nullptr)
+        {
+            Callback = callback; CallbackUserData = user_data; return *this;
+        }
+    };
+
+    // Draws text with all stages of fx applied in a single pass. The reserved box includes the wobble and shake
+    // envelopes and does not change while the text is being revealed.
+    // Returns the glyph count of text, or -1 when the item was clipped and nothing was laid out.
+    inline int TextEffects(const char* text, const TextEffect& fx)
+    {
+        ImGuiWindow* window = ImGui::GetCurrentWindow();
+
+        // Layout: text box padded by the displacement envelopes
+        const char* text_end = text + strlen(text);
+        const float pad_x = fx.ShakeSpread.x;
+        float wrap_width = fx.WrapWidth;
+        if (wrap_width < 0.0f)
+            wrap_width = ImMax(ImGui::GetContentRegionAvail().x - pad_x * 2.0f, 1.0f);
+        const bool has_gradient = fx.GradientStops != nullptr && fx.GradientStopCount > 0;
+        const ImU32 tpl_col = has_gradient ? IM_COL32_WHITE : fx.Col;
+        const ImGuiID id = AnimHelpers::TextTemplateKey(text, tpl_col, wrap_width); // before SkipItems so SetNextAnimTextID never leaks
+        if (window->SkipItems)
+            return -1;
+        const ImVec2 text_size = AnimHelpers::CalcTemplateTextSize(id, text, text_end, wrap_width);
+        const float pad_y = fx.WobbleAmp + fx.ShakeSpread.y;
+        const ImVec2 top_left = window->DC.CursorPos;
+        if (!AnimHelpers::AnimTextItemAdd(ImVec2(text_size.x + pad_x * 2.0f, text_size.y + pad_y * 2.0f)))
+            return -1; // clipped: no glyphs, no vertex work
+
+        const AnimHelpers::GlyphVtxTemplate& tpl = AnimHelpers::GetTextTemplate(id, text, text_end, tpl_col, wrap_width);
+
+        const int glyph_count = tpl.vtx.Size / 4; // AddText only emits glyph quads
+        if (glyph_count == 0)
+            return 0;
+        IM_ASSERT(tpl.vtx.Size == glyph_count * 4 && tpl.idx.Size == glyph_count * 6);
+
+        // Reveal: hidden glyphs form a suffix of the template and are not emitted at all.
+        // Glyph q fades in while revealed goes from q + 1 - fade to q + 1.
+        float revealed = (float)glyph_count;
+        if (fx.RevealGlyphs >= 0.0f)
+            revealed = ImMin(fx.RevealGlyphs, revealed);
+        else if (fx.RevealProgress >= 0.0f)
+            revealed = fx.RevealProgress * glyph_count;
+        const float fade = ImMax(fx.RevealFade, 1e-3f);
+        const int emit_count = ImMin(glyph_count, (int)ceilf(revealed + fade - 1.0f));
+        const ImU32 alpha8 = (ImU32)(ImSaturate(fx.Alpha) * 255.0f + 0.5f);
+        if (emit_count <= 0 || alpha8 == 0)
+            return glyph_count;
+
+        // Per frame constants of every stage. The clock is only read by the stages that move,
+        // so static effects (tint, reveal driven by the caller) do not keep the application rendering.
+        const ImVec2 origin = ImTrunc(ImVec2(top_left.x + pad_x, top_left.y + pad_y));
+
+        const bool has_wobble = fx.WobbleAmp != 0.0f && tpl.text_size.x > 0.0f;
+        const float two_pi = 6.28319f;
+        const float wobble_scale = has_wobble ? two_pi * fx.WobbleFreq / tpl.text_size.x : 0.0f;
+        const float wobble_phase = (has_wobble && fx.WobbleSpeed != 0.0f) ? two_pi * ImGui::AnimPhase(fx.WobbleSpeed) : 0.0f;
+
+        const bool has_shake = fx.ShakeSpread.x != 0.0f || fx.ShakeSpread.y != 0.0f;
+        const float t = ((has_shake && fx.ShakeSpeed != 0.0f) || fx.Callback) ? ImGui::AnimTimeWrapped() : 0.0f;
+        uint32_t shake_kx = 0, shake_ky = 0; float shake_wx = 0.0f, shake_wy = 0.0f;
+        if (has_shake)
+        {
+            AnimKernels::NoiseStep(t, fx.ShakeSpeed, fx.ShakeRoughness, &shake_kx, &shake_wx);
+            AnimKernels::NoiseStep(t, fx.ShakeSpeed * 1.13f, fx.ShakeRoughness, &shake_ky, &shake_wy);
+        }
+
+        const ImU32* lut = nullptr;
+        float lut_scale = 0.0f, grad_u_scale = 0.0f, grad_u_bias = 0.0f, grad_phase = fx.GradientOffset;
+        if (has_gradient)
+        {
+            const ImGui::GradientLut& grad = ImGui::GetGradientLut(fx.GradientStops, fx.GradientStopCount, fx.GradientHsv);
+            lut = grad.Colors.Data;
+            lut_scale = (float)(grad.Size() - 1);
+            const float span = ImMax(1.0f, tpl.max_x - tpl.min_x);
+            grad_u_scale = 1.0f / span;
+            grad_u_bias = -tpl.min_x / span;
+            if (fx.GradientMode != 0 && fx.GradientSpeed != 0.0f)
+                grad_phase += ImGui::AnimPhase(fx.GradientSpeed);
+        }
+
+        ImDrawList* dl = window->DrawList;
+        dl->PushTexture(ImGui::GetFont()->ContainerAtlas->TexRef);
+        dl->PrimReserve(emit_count * 6, emit_count * 4);
+        ImDrawVert* vtx_write = dl->_VtxWritePtr;
+        ImDrawIdx* idx_write = dl->_IdxWritePtr;
+        const unsigned int vtx_base = dl->_VtxCurrentIdx;
+
+        ImDrawVert* const vtx_begin = vtx_write;
+        const ImDrawVert* src = tpl.vtx.Data;
+        for (int q = 0; q < emit_count; ++q, src += 4)
+        {
+            // Per glyph: shake offset and reveal alpha
+            float jx = 0.0f, jy = 0.0f;
+            if (has_shake)
+            {
+                const uint32_t sx = (uint32_t)(0x9E3779B9u * (q + 17)) + (uint32_t)(int32_t)(fx.ShakeChaos * 997.0f);
+                const uint32_t sy = (uint32_t)(0x85EBCA6Bu * (q + 31)) + (uint32_t)(int32_t)(fx.ShakeChaos * 1511.0f);
+                const float ax = AnimKernels::Hash01(sx + shake_kx), bx = AnimKernels::Hash01(sx + shake_kx + 1u);
+                const float ay = AnimKernels::Hash01(sy + shake_ky), by = AnimKernels::Hash01(sy + shake_ky + 1u);
+                jx = floorf(((ax + (bx - ax) * shake_wx) * 2.0f - 1.0f) * fx.ShakeSpread.x + 0.5f);
+                jy = floorf(((ay + (by - ay) * shake_wy) * 2.0f - 1.0f) * fx.ShakeSpread.y + 0.5f);
+            }
+            ImU32 glyph_a = 255;
+            if (q + 1 > revealed)
+                glyph_a = (ImU32)(ImSaturate((revealed - (q + 1 - fade)) / fade) * 255.0f + 0.5f);
+
+            for (int n = 0; n < 4; ++n)
+            {
+                const float x = src[n].pos.x;
+                float y = src[n].pos.y;
+                if (has_wobble)
+                    y += fx.WobbleAmp * AnimMath::fast_sin(x * wobble_scale + wobble_phase);
+
+                ImU32 col = src[n].col;
+                ImU32 a = col >> IM_COL32_A_SHIFT;
+                if (lut)
+                {
+                    const float tval = AnimKernels::GradientShape(x * grad_u_scale + grad_u_bias, grad_phase, fx.GradientMode, fx.GradientSmoothPeaks);
+                    const ImU32 c = lut[(int)(tval * lut_scale + 0.5f)];
+                    a = AnimKernels::MulAlpha255(c >> IM_COL32_A_SHIFT, a);
+                    col = c;
+                }
+                if (glyph_a != 255)
+                    a = AnimKernels::MulAlpha255(a, glyph_a);
+
+                ImDrawVert& v = vtx_write[n];
+                v.pos.x = origin.x + x + jx;
+                v.pos.y = origin.y + y + jy;
+                v.uv = src[n].uv;
+                v.col = (col & ~IM_COL32_A_MASK) | (a << IM_COL32_A_SHIFT);
+            }
+            if (fx.Callback)
+                fx.Callback(vtx_write, q, glyph_count, t, fx.CallbackUserData);
+
+            const ImDrawIdx i0 = (ImDrawIdx)(vtx_base + q * 4);
+            idx_write[0] = i0; idx_write[1] = (ImDrawIdx)(i0 + 1); idx_write[2] = (ImDrawIdx)(i0 + 2);
+            idx_write[3] = i0; idx_write[4] = (ImDrawIdx)(i0 + 2); idx_write[5] = (ImDrawIdx)(i0 + 3);
+            vtx_write += 4;
+            idx_write += 6;
+        }
+        // Uniform fade, one SIMD pass over every emitted vertex
+        if (alpha8 != 255)
+            AnimKernels::Get().MultiplyAlpha(vtx_begin, emit_count * 4, fx.Alpha);
+        dl->_VtxWritePtr = vtx_write;
+        dl->_IdxWritePtr = idx_write;
+        dl->_VtxCurrentIdx += (unsigned int)(emit_count * 4);
+        dl->PopTexture();
+        return glyph_count;
+    }
+
+
+    // Typewriter reveal: shows the first revealed_glyphs glyphs of text, each one fading in over fade_glyphs glyphs.
+    // The whole text (wrapped if requested) is laid out once and its glyph quads cached, so every frame only copies the
+    // revealed prefix instead of laying out a growing substring. The item keeps the size of the full text while revealing.
+    // wrap_width: 0 = no wrapping, < 0 = wrap at the end of the content region (like TextWrapped).
+    // Returns true once every glyph is fully visible.
+    inline bool TextTypewriter(const char* text, float revealed_glyphs, float fade_glyphs = 1.0f, float wrap_width = -1.0f, ImU32 col = 0)
+    {
+        TextEffect fx;
+        fx.Color(col ? col : ImGui::GetColorU32(ImGuiCol_Text)).Wrap(wrap_width).RevealCount(revealed_glyphs, fade_glyphs);
+        const int drawn = TextEffects(text, fx);
+
+        // Glyph count of the template TextEffects used, counted without layout when the item is clipped
+        const int glyph_count = drawn >= 0 ? drawn : AnimHelpers::CountTextGlyphs(text, text + strlen(text));
+        return revealed_glyphs >= (float)glyph_count;
+    }
+
+    // Same, revealing glyphs_per_second glyphs from start_time on (e.g. the ImGui::GetTime() when the text was set).
+    inline bool TextTypewriterTimed(const char* text, double start_time, float glyphs_per_second = 30.0f, float fade_glyphs = 3.0f,
+        float wrap_width = -1.0f, ImU32 col = 0)
+    {
+        const float revealed = (float)ImMax(ImGui::GetTime() - start_time, 0.0) * glyphs_per_second;
+        const bool done = TextTypewriter(text, revealed, fade_glyphs, wrap_width, col);
+        if (!done && !ImGui::GetCurrentWindowRead()->SkipItems && ImGui::IsItemVisible())
+            ImGui::AnimActiveNextFrame(); // a clipped reveal catches up from the clock once it is visible again
+        return done;
+    }
 
     inline std::string GetAnimatedDots(int dotCount = 3, float secondsPerStep = 0.3f)
     {
-        int dots = static_cast<int>(ImGui::GetTime() / secondsPerStep) % (dotCount + 1);
+        const double step = floor(ImGui::GetTime() / secondsPerStep);
+        ImGui::AnimWakeAt((step + 1.0) * secondsPerStep);
+        int dots = static_cast<int>(fmod(step, (double)(dotCount + 1)));
         return std::string(dots, '.');
     }
     inline void TextWithAnimatedDots(const char* text, int dotCount = 3, float secondsPerStep = 0.3f)
@@ -316,6 +816,8 @@ namespace ImGui
         ImGuiID id_offset = id;
         ImGuiID id_phase = id + 1;
         ImGuiID id_delayt = id + 2;
+        const ImGuiID keys[] = { id_offset, id_phase, id_delayt };
+        TouchWidgetState(window, id, keys, IM_ARRAYSIZE(keys));
 
         float offset = storage->GetFloat(id_offset, 0.0f);
         int   phase = storage->GetInt(id_phase, 0); // default: scrolling
@@ -384,6 +886,10 @@ namespace ImGui
         storage->SetFloat(id_offset, offset);
         storage->SetInt(id_phase, phase);
         storage->SetFloat(id_delayt, delay_t);
+        if (phase == 0)
+            ImGui::AnimActiveNextFrame();
+        else if (phase == 1)
+            ImGui::AnimWakeAt(ImGui::GetAnimTime() + (offscreen_delay - delay_t));
 
         ImDrawList* draw_list = ImGui::GetWindowDrawList();
         ImU32 col_text = ImGui::GetColorU32(ImGuiCol_Text);
@@ -441,26 +947,13 @@ namespace ImGui
         if (region_w <= 0.0f)
             region_w = 1.0f;
 
-        // Precompute width & max height of all texts
-        std::vector<float> widths(text_count);
-        float max_text_h = 0.0f;
-
-        for (int i = 0; i < text_count; ++i)
-        {
-            const char* t = texts[i] ? texts[i] : "";
-            ImVec2 sz = ImGui::CalcTextSize(t, nullptr, false);
-            if (sz.x <= 0.0f)
-                sz.x = 1.0f;
-            widths[i] = sz.x;
-            if (sz.y > max_text_h)
-                max_text_h = sz.y;
-        }
-        if (max_text_h <= 0.0f)
-            max_text_h = 1.0f;
+        // Widths, max height and prefix offsets of all texts, measured once per text list
+        ImGuiID id = window->GetID(str_id);
+        const AnimHelpers::MarqueeLayout& layout = AnimHelpers::GetMarqueeLayout(id, texts, text_count, gap);
+        const float* widths = layout.widths.Data;
 
-        ImVec2 item_size(region_w, max_text_h + style.FramePadding.y * 2.0f);
+        ImVec2 item_size(region_w, layout.max_text_h + style.FramePadding.y * 2.0f);
 
-        ImGuiID id = window->GetID(str_id);
         ImRect bb(window->DC.CursorPos,
             ImVec2(window->DC.CursorPos.x + item_size.x,
                 window->DC.CursorPos.y + item_size.y));
@@ -476,11 +969,15 @@ namespace ImGui
         ImGuiStorage* storage = ImGui::GetStateStorage();
         ImGuiID id_offset = id;
         ImGuiID id_index = id + 1; // only used for sequential mode
+        const ImGuiID keys[] = { id_offset, id_index };
+        TouchWidgetState(window, id, keys, IM_ARRAYSIZE(keys));
 
         float offset = storage->GetFloat(id_offset, 0.0f);
         int index = storage->GetInt(id_index, 0);
 
         offset += io.DeltaTime * speed;
+        if (speed != 0.0f)
+            ImGui::AnimActiveNextFrame();
 
         ImGui::PushClipRect(bb.Min, bb.Max, true);
 
@@ -539,34 +1036,37 @@ namespace ImGui
         else
         {
             // ** CONTINUOUS  MODE (gap >= 0) **
-            // Build pattern: [text0][gap][text1][gap]...[textN-1][gap] then repeat
-            std::vector<float> starts(text_count);
-            float pattern_w = 0.0f;
-            for (int i = 0; i < text_count; ++i)
-            {
-                starts[i] = pattern_w;
-                pattern_w += widths[i] + gap;
-            }
-            if (pattern_w <= 0.0f)
-                pattern_w = 1.0f;
+            // Pattern: [text0][gap][text1][gap]...[textN-1][gap] then repeat
+            const float* starts = layout.starts.Data;
+            const float pattern_w = layout.pattern_w;
 
             // Wrap offset to [0, pattern_w)
             offset = fmodf(offset, pattern_w);
             if (offset < 0.0f)
                 offset += pattern_w;
 
-            // Well draw a few copies of the pattern to cover the visible area.
-            // Use k = -1, 0, 1 copies of the full pattern.
-            for (int k = -1; k <= 1; ++k)
+            // In pattern-space, a text starting at s is visible when s <= offset and s + w >= offset - region_w
+            // (both directions). Walk back copy by copy of the pattern until it ends before the visible span,
+            // binary searching the prefix offsets for the first visible text of each copy.
+            const float vis_min = offset - region_w;
+            for (int k = 0; (k + 1) * pattern_w > vis_min; --k)
             {
-                float pattern_shift = k * pattern_w; // shift in pattern-space
+                const float pattern_shift = k * pattern_w;
+                int lo = 0, hi = text_count;
+                while (lo < hi)
+                {
+                    const int mid = (lo + hi) / 2;
+                    if (starts[mid] + widths[mid] + pattern_shift < vis_min) lo = mid + 1; else hi = mid;
+                }
 
-                for (int i = 0; i < text_count; ++i)
+                for (int i = lo; i < text_count; ++i)
                 {
+                    const float s = starts[i] + pattern_shift; // start position in pattern-space
+                    if (s > offset)
+                        break;
+
                     const char* t = texts[i] ? texts[i] : "";
                     float w = widths[i];
-                    float s = starts[i] + pattern_shift; // start position in pattern-space
-
                     float x;
                     if (right_to_left)
                     {
@@ -580,10 +1080,6 @@ namespace ImGui
                         x = bb.Min.x - w + (offset - s);
                     }
 
-                    // Cull segments totally off screen
-                    if (x > bb.Max.x || x + w < bb.Min.x)
-                        continue;
-
                     draw_list->AddText(ImVec2(x, text_y), col_text, t);
                 }
             }
@@ -606,11 +1102,12 @@ namespace ImGui
         float gap = -1.0f,
         bool loop_texts = true)
     {
-        std::vector<const char*> cstrs;
-        cstrs.reserve(texts.size());
-        for (const auto& s : texts)
-            cstrs.push_back(s.c_str());
-        TextMarqueeMultiple(str_id, cstrs.data(), static_cast<int>(cstrs.size()),
+        // Pointers go through a scratch array owned by the context, which only grows: no allocation on steady frames
+        ImVector<const char*>& cstrs = AnimHelpers::GetMarqueeCache().CStrs;
+        cstrs.resize((int)texts.size());
+        for (int i = 0; i < cstrs.Size; ++i)
+            cstrs[i] = texts[i].c_str();
+        TextMarqueeMultiple(str_id, cstrs.Data, cstrs.Size,
             width, speed, right_to_left, gap, loop_texts);
 	}
 
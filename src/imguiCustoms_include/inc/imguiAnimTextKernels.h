@@ -0,0 +1,701 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+#include <imgui.h>
+#include <imgui_internal.h>
+#include "imguiAnimMath.h"
+
+// Per-vertex kernels used by the animated text effects. Every kernel has a scalar version and, where the
+// target has them, SSE2 / AVX2 / NEON versions that process 4 or 8 vertices per step. The best supported
+// set is picked at runtime on first use (AVX2 is compiled in with a target attribute and only used when the CPU has it).
+// All kernels work on template vertices: positions are relative to the text origin and 'offset' is added to them.
+// Everything here has external linkage, so the whole program shares one active kernel table (and one CPUID probe).
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ANIMTEXT_KERNELS_SSE2 1
+#include <emmintrin.h>
+#if defined(_MSC_VER) || defined(__GNUC__) || defined(__clang__)
+#define ANIMTEXT_KERNELS_AVX2 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define ANIMTEXT_TARGET_AVX2
+#else
+#define ANIMTEXT_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+#endif
+
+#if defined(__ARM_NEON) || defined(_M_ARM64)
+#define ANIMTEXT_KERNELS_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace AnimKernels
+{
+    typedef int KernelLevel;
+    enum KernelLevel_
+    {
+        KernelLevel_Auto = -1,  // best level supported by the CPU
+        KernelLevel_Scalar = 0,
+        KernelLevel_SSE2,
+        KernelLevel_AVX2,
+        KernelLevel_NEON,
+        KernelLevel_COUNT
+    };
+
+    struct KernelTable
+    {
+        KernelLevel Level;
+        const char* Name;
+        // pos += offset, pos.y += amp * sin(pos.x * x_scale + phase) (pos.x taken before the offset)
+        void (*SineDisplaceY)(ImDrawVert* v, int count, ImVec2 offset, float x_scale, float phase, float amp);
+        // Moves each quad (4 consecutive vertices) by its own 1D value noise, rounded to whole pixels.
+        // seeds_x/seeds_y hold one seed per quad, speed is in noise samples per second.
+        void (*NoiseDisplaceQuads)(ImDrawVert* v, int quad_count, const ImU32* seeds_x, const ImU32* seeds_y,
+            float t, float speed_x, float speed_y, float roughness, ImVec2 spread);
+        // pos += offset, col = lut[u] with its alpha multiplied by the vertex alpha.
+        // u = pos.x * u_scale + u_bias (+ phase), shaped by mode: 0 = clamp, 1 = repeat, 2 = pingpong (smooth_peaks: smoothstep the turns)
+        void (*GradientLutRecolor)(ImDrawVert* v, int count, ImVec2 offset, const ImU32* lut, int lut_size,
+            float u_scale, float u_bias, float phase, int mode, bool smooth_peaks);
+        // Multiplies the vertex alpha by alpha in [0,1]
+        void (*MultiplyAlpha)(ImDrawVert* v, int count, float alpha);
+    };
+
+    // ---------- SCALAR ----------
+    // Shared with the scalar animation helpers, so every kernel level produces the same noise
+    using AnimMath::Hash01;
+    using AnimMath::NoiseStep;
+
+    inline ImU32 MulAlpha255(ImU32 a, ImU32 b) // a * b / 255, rounded
+    {
+        ImU32 p = a * b + 128;
+        return (p + (p >> 8)) >> 8;
+    }
+
+    inline float GradientShape(float u, float phase, int mode, bool smooth_peaks)
+    {
+        if (mode == 0)
+            return ImClamp(u, 0.0f, 1.0f);
+        float s = u + phase;
+        s -= floorf(s);
+        if (mode == 1)
+            return s;
+        float tri = 1.0f - fabsf(2.0f * s - 1.0f);
+        return smooth_peaks ? tri * tri * (3.0f - 2.0f * tri) : tri;
+    }
+
+    inline void SineDisplaceY_Scalar(ImDrawVert* v, int count, ImVec2 offset, float x_scale, float phase, float amp)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            float s = AnimMath::fast_sin(v[i].pos.x * x_scale + phase);
+            v[i].pos.x += offset.x;
+            v[i].pos.y += offset.y + amp * s;
+        }
+    }
+
+    inline void NoiseDisplaceQuads_Scalar(ImDrawVert* v, int quad_count, const ImU32* seeds_x, const ImU32* seeds_y,
+        float t, float speed_x, float speed_y, float roughness, ImVec2 spread)
+    {
+        uint32_t kx, ky; float wx, wy;
+        NoiseStep(t, speed_x, roughness, &kx, &wx);
+        NoiseStep(t, speed_y, roughness, &ky, &wy);
+        for (int q = 0; q < quad_count; ++q)
+        {
+            float ax = Hash01(seeds_x[q] + kx), bx = Hash01(seeds_x[q] + kx + 1u);
+            float ay = Hash01(seeds_y[q] + ky), by = Hash01(seeds_y[q] + ky + 1u);
+            float jx = floorf(((ax + (bx - ax) * wx) * 2.0f - 1.0f) * spread.x + 0.5f);
+            float jy = floorf(((ay + (by - ay) * wy) * 2.0f - 1.0f) * spread.y + 0.5f);
+            ImDrawVert* quad = v + q * 4;
+            for (int n = 0; n < 4; ++n)
+            {
+                quad[n].pos.x += jx;
+                quad[n].pos.y += jy;
+            }
+        }
+    }
+
+    inline void GradientLutRecolor_Scalar(ImDrawVert* v, int count, ImVec2 offset, const ImU32* lut, int lut_size,
+        float u_scale, float u_bias, float phase, int mode, bool smooth_peaks)
+    {
+        const float idx_scale = (float)(lut_size - 1);
+        for (int i = 0; i < count; ++i)
+        {
+            float tval = GradientShape(v[i].pos.x * u_scale + u_bias, phase, mode, smooth_peaks);
+            ImU32 c = lut[(int)(tval * idx_scale + 0.5f)];
+            ImU32 a = MulAlpha255(c >> IM_COL32_A_SHIFT, v[i].col >> IM_COL32_A_SHIFT);
+            v[i].col = (c & ~IM_COL32_A_MASK) | (a << IM_COL32_A_SHIFT);
+            v[i].pos.x += offset.x;
+            v[i].pos.y += offset.y;
+        }
+    }
+
+    inline void MultiplyAlpha_Scalar(ImDrawVert* v, int count, float alpha)
+    {
+        const ImU32 m = (ImU32)(ImClamp(alpha, 0.0f, 1.0f) * 255.0f + 0.5f);
+        for (int i = 0; i < count; ++i)
+        {
+            ImU32 a = MulAlpha255(v[i].col >> IM_COL32_A_SHIFT, m);
+            v[i].col = (v[i].col & ~IM_COL32_A_MASK) | (a << IM_COL32_A_SHIFT);
+        }
+    }
+
+    // Polynomial constants shared by the vector sines, see AnimMath::fast_sin
+    using AnimMath::kInvTwoPi;
+    using AnimMath::kTwoPi;
+    using AnimMath::kSinC3; using AnimMath::kSinC5; using AnimMath::kSinC7; using AnimMath::kSinC9;
+
+#ifdef ANIMTEXT_KERNELS_SSE2
+    // ---------- SSE2 (4 lanes) ----------
+    inline __m128 Floor_SSE2(__m128 x)
+    {
+        __m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+        return _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, x), _mm_set1_ps(1.0f)));
+    }
+
+    inline __m128 Sin_SSE2(__m128 x)
+    {
+        // Reduce to r in [-0.5, 0.5] turns, then fold to [-0.25, 0.25] with sin(pi - a) = sin(a)
+        __m128 r = _mm_mul_ps(x, _mm_set1_ps(kInvTwoPi));
+        r = _mm_sub_ps(r, Floor_SSE2(_mm_add_ps(r, _mm_set1_ps(0.5f))));
+        r = _mm_min_ps(r, _mm_sub_ps(_mm_set1_ps(0.5f), r));
+        r = _mm_max_ps(r, _mm_sub_ps(_mm_set1_ps(-0.5f), r));
+        __m128 a = _mm_mul_ps(r, _mm_set1_ps(kTwoPi));
+        __m128 a2 = _mm_mul_ps(a, a);
+        __m128 p = _mm_add_ps(_mm_set1_ps(kSinC7), _mm_mul_ps(a2, _mm_set1_ps(kSinC9)));
+        p = _mm_add_ps(_mm_set1_ps(kSinC5), _mm_mul_ps(a2, p));
+        p = _mm_add_ps(_mm_set1_ps(kSinC3), _mm_mul_ps(a2, p));
+        p = _mm_add_ps(_mm_set1_ps(1.0f), _mm_mul_ps(a2, p));
+        return _mm_mul_ps(a, p);
+    }
+
+    inline __m128i Mullo32_SSE2(__m128i a, __m128i b) // SSE2 has no _mm_mullo_epi32
+    {
+        __m128i even = _mm_mul_epu32(a, b);
+        __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+        return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+    }
+
+    inline __m128 Hash01_SSE2(__m128i x)
+    {
+        x = _mm_xor_si128(x, Mullo32_SSE2(x, _mm_set1_epi32(0x27d4eb2d)));
+        x = _mm_xor_si128(x, _mm_srli_epi32(x, 15)); x = Mullo32_SSE2(x, _mm_set1_epi32((int)0x85ebca6b));
+        x = _mm_xor_si128(x, _mm_srli_epi32(x, 13)); x = Mullo32_SSE2(x, _mm_set1_epi32((int)0xc2b2ae35));
+        x = _mm_xor_si128(x, _mm_srli_epi32(x, 16));
+        return _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(x, _mm_set1_epi32(0x00FFFFFF))), _mm_set1_ps(1.0f / 16777216.0f));
+    }
+
+    inline __m128 GradientShape_SSE2(__m128 u, float phase, int mode, bool smooth_peaks)
+    {
+        if (mode == 0)
+            return _mm_min_ps(_mm_max_ps(u, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+        __m128 s = _mm_add_ps(u, _mm_set1_ps(phase));
+        s = _mm_sub_ps(s, Floor_SSE2(s));
+        if (mode == 1)
+            return s;
+        __m128 d = _mm_sub_ps(_mm_add_ps(s, s), _mm_set1_ps(1.0f));
+        __m128 tri = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_andnot_ps(_mm_set1_ps(-0.0f), d));
+        if (smooth_peaks)
+            tri = _mm_mul_ps(_mm_mul_ps(tri, tri), _mm_sub_ps(_mm_set1_ps(3.0f), _mm_add_ps(tri, tri)));
+        return tri;
+    }
+
+    // a * b / 255 per 32-bit lane, both < 256
+    inline __m128i MulAlpha255_SSE2(__m128i a, __m128i b)
+    {
+        __m128i p = _mm_add_epi32(_mm_mullo_epi16(a, b), _mm_set1_epi32(128));
+        return _mm_srli_epi32(_mm_add_epi32(p, _mm_srli_epi32(p, 8)), 8);
+    }
+
+    inline void SineDisplaceY_SSE2(ImDrawVert* v, int count, ImVec2 offset, float x_scale, float phase, float amp)
+    {
+        const __m128 vscale = _mm_set1_ps(x_scale), vphase = _mm_set1_ps(phase), vamp = _mm_set1_ps(amp);
+        int i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 x = _mm_setr_ps(v[i].pos.x, v[i + 1].pos.x, v[i + 2].pos.x, v[i + 3].pos.x);
+            __m128 d = _mm_mul_ps(vamp, Sin_SSE2(_mm_add_ps(_mm_mul_ps(x, vscale), vphase)));
+            alignas(16) float dy[4];
+            _mm_store_ps(dy, d);
+            for (int n = 0; n < 4; ++n)
+            {
+                v[i + n].pos.x += offset.x;
+                v[i + n].pos.y += offset.y + dy[n];
+            }
+        }
+        SineDisplaceY_Scalar(v + i, count - i, offset, x_scale, phase, amp);
+    }
+
+    inline void NoiseDisplaceQuads_SSE2(ImDrawVert* v, int quad_count, const ImU32* seeds_x, const ImU32* seeds_y,
+        float t, float speed_x, float speed_y, float roughness, ImVec2 spread)
+    {
+        uint32_t kx, ky; float wx, wy;
+        NoiseStep(t, speed_x, roughness, &kx, &wx);
+        NoiseStep(t, speed_y, roughness, &ky, &wy);
+        const __m128i vkx = _mm_set1_epi32((int)kx), vky = _mm_set1_epi32((int)ky), one = _mm_set1_epi32(1);
+        const __m128 vwx = _mm_set1_ps(wx), vwy = _mm_set1_ps(wy);
+        const __m128 vsx = _mm_set1_ps(spread.x), vsy = _mm_set1_ps(spread.y), two = _mm_set1_ps(2.0f), half = _mm_set1_ps(0.5f), onef = _mm_set1_ps(1.0f);
+        int q = 0;
+        for (; q + 4 <= quad_count; q += 4)
+        {
+            __m128i sx = _mm_add_epi32(_mm_loadu_si128((const __m128i*)(seeds_x + q)), vkx);
+            __m128i sy = _mm_add_epi32(_mm_loadu_si128((const __m128i*)(seeds_y + q)), vky);
+            __m128 ax = Hash01_SSE2(sx), bx = Hash01_SSE2(_mm_add_epi32(sx, one));
+            __m128 ay = Hash01_SSE2(sy), by = Hash01_SSE2(_mm_add_epi32(sy, one));
+            __m128 nx = _mm_add_ps(ax, _mm_mul_ps(_mm_sub_ps(bx, ax), vwx));
+            __m128 ny = _mm_add_ps(ay, _mm_mul_ps(_mm_sub_ps(by, ay), vwy));
+            __m128 jx = Floor_SSE2(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(_mm_mul_ps(nx, two), onef), vsx), half));
+            __m128 jy = Floor_SSE2(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(_mm_mul_ps(ny, two), onef), vsy), half));
+            alignas(16) float dx[4], dy[4];
+            _mm_store_ps(dx, jx);
+            _mm_store_ps(dy, jy);
+            for (int n = 0; n < 4; ++n)
+            {
+                ImDrawVert* quad = v + (q + n) * 4;
+                for (int c = 0; c < 4; ++c)
+                {
+                    quad[c].pos.x += dx[n];
+                    quad[c].pos.y += dy[n];
+                }
+            }
+        }
+        NoiseDisplaceQuads_Scalar(v + q * 4, quad_count - q, seeds_x + q, seeds_y + q, t, speed_x, speed_y, roughness, spread);
+    }
+
+    inline void GradientLutRecolor_SSE2(ImDrawVert* v, int count, ImVec2 offset, const ImU32* lut, int lut_size,
+        float u_scale, float u_bias, float phase, int mode, bool smooth_peaks)
+    {
+        const __m128 vscale = _mm_set1_ps(u_scale), vbias = _mm_set1_ps(u_bias);
+        const __m128 idx_scale = _mm_set1_ps((float)(lut_size - 1)), half = _mm_set1_ps(0.5f);
+        const __m128i rgb_mask = _mm_set1_epi32((int)~IM_COL32_A_MASK);
+        int i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 x = _mm_setr_ps(v[i].pos.x, v[i + 1].pos.x, v[i + 2].pos.x, v[i + 3].pos.x);
+            __m128 tval = GradientShape_SSE2(_mm_add_ps(_mm_mul_ps(x, vscale), vbias), phase, mode, smooth_peaks);
+            alignas(16) int idx[4];
+            _mm_store_si128((__m128i*)idx, _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(tval, idx_scale), half)));
+            __m128i c = _mm_setr_epi32((int)lut[idx[0]], (int)lut[idx[1]], (int)lut[idx[2]], (int)lut[idx[3]]);
+            __m128i vc = _mm_setr_epi32((int)v[i].col, (int)v[i + 1].col, (int)v[i + 2].col, (int)v[i + 3].col);
+            __m128i a = MulAlpha255_SSE2(_mm_srli_epi32(c, IM_COL32_A_SHIFT), _mm_srli_epi32(vc, IM_COL32_A_SHIFT));
+            alignas(16) ImU32 out[4];
+            _mm_store_si128((__m128i*)out, _mm_or_si128(_mm_and_si128(c, rgb_mask), _mm_slli_epi32(a, IM_COL32_A_SHIFT)));
+            for (int n = 0; n < 4; ++n)
+            {
+                v[i + n].col = out[n];
+                v[i + n].pos.x += offset.x;
+                v[i + n].pos.y += offset.y;
+            }
+        }
+        GradientLutRecolor_Scalar(v + i, count - i, offset, lut, lut_size, u_scale, u_bias, phase, mode, smooth_peaks);
+    }
+
+    inline void MultiplyAlpha_SSE2(ImDrawVert* v, int count, float alpha)
+    {
+        const __m128i m = _mm_set1_epi32((int)(ImClamp(alpha, 0.0f, 1.0f) * 255.0f + 0.5f));
+        const __m128i rgb_mask = _mm_set1_epi32((int)~IM_COL32_A_MASK);
+        int i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i vc = _mm_setr_epi32((int)v[i].col, (int)v[i + 1].col, (int)v[i + 2].col, (int)v[i + 3].col);
+            __m128i a = MulAlpha255_SSE2(_mm_srli_epi32(vc, IM_COL32_A_SHIFT), m);
+            alignas(16) ImU32 out[4];
+            _mm_store_si128((__m128i*)out, _mm_or_si128(_mm_and_si128(vc, rgb_mask), _mm_slli_epi32(a, IM_COL32_A_SHIFT)));
+            for (int n = 0; n < 4; ++n)
+                v[i + n].col = out[n];
+        }
+        MultiplyAlpha_Scalar(v + i, count - i, alpha);
+    }
+#endif // ANIMTEXT_KERNELS_SSE2
+
+#ifdef ANIMTEXT_KERNELS_AVX2
+    // ---------- AVX2 (8 lanes) ----------
+    ANIMTEXT_TARGET_AVX2 inline __m256 Sin_AVX2(__m256 x)
+    {
+        __m256 r = _mm256_mul_ps(x, _mm256_set1_ps(kInvTwoPi));
+        r = _mm256_sub_ps(r, _mm256_floor_ps(_mm256_add_ps(r, _mm256_set1_ps(0.5f))));
+        r = _mm256_min_ps(r, _mm256_sub_ps(_mm256_set1_ps(0.5f), r));
+        r = _mm256_max_ps(r, _mm256_sub_ps(_mm256_set1_ps(-0.5f), r));
+        __m256 a = _mm256_mul_ps(r, _mm256_set1_ps(kTwoPi));
+        __m256 a2 = _mm256_mul_ps(a, a);
+        __m256 p = _mm256_add_ps(_mm256_set1_ps(kSinC7), _mm256_mul_ps(a2, _mm256_set1_ps(kSinC9)));
+        p = _mm256_add_ps(_mm256_set1_ps(kSinC5), _mm256_mul_ps(a2, p));
+        p = _mm256_add_ps(_mm256_set1_ps(kSinC3), _mm256_mul_ps(a2, p));
+        p = _mm256_add_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(a2, p));
+        return _mm256_mul_ps(a, p);
+    }
+
+    ANIMTEXT_TARGET_AVX2 inline __m256 Hash01_AVX2(__m256i x)
+    {
+        x = _mm256_xor_si256(x, _mm256_mullo_epi32(x, _mm256_set1_epi32(0x27d4eb2d)));
+        x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 15)); x = _mm256_mullo_epi32(x, _mm256_set1_epi32((int)0x85ebca6b));
+        x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 13)); x = _mm256_mullo_epi32(x, _mm256_set1_epi32((int)0xc2b2ae35));
+        x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 16));
+        return _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(x, _mm256_set1_epi32(0x00FFFFFF))), _mm256_set1_ps(1.0f / 16777216.0f));
+    }
+
+    ANIMTEXT_TARGET_AVX2 inline __m256 GradientShape_AVX2(__m256 u, float phase, int mode, bool smooth_peaks)
+    {
+        if (mode == 0)
+            return _mm256_min_ps(_mm256_max_ps(u, _mm256_setzero_ps()), _mm256_set1_ps(1.0f));
+        __m256 s = _mm256_add_ps(u, _mm256_set1_ps(phase));
+        s = _mm256_sub_ps(s, _mm256_floor_ps(s));
+        if (mode == 1)
+            return s;
+        __m256 d = _mm256_sub_ps(_mm256_add_ps(s, s), _mm256_set1_ps(1.0f));
+        __m256 tri = _mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_andnot_ps(_mm256_set1_ps(-0.0f), d));
+        if (smooth_peaks)
+            tri = _mm256_mul_ps(_mm256_mul_ps(tri, tri), _mm256_sub_ps(_mm256_set1_ps(3.0f), _mm256_add_ps(tri, tri)));
+        return tri;
+    }
+
+    ANIMTEXT_TARGET_AVX2 inline __m256i MulAlpha255_AVX2(__m256i a, __m256i b)
+    {
+        __m256i p = _mm256_add_epi32(_mm256_mullo_epi16(a, b), _mm256_set1_epi32(128));
+        return _mm256_srli_epi32(_mm256_add_epi32(p, _mm256_srli_epi32(p, 8)), 8);
+    }
+
+    // Gather offsets of pos.x / col of 8 consecutive vertices, in 4 byte units (ImDrawVert is 5 floats wide by default)
+    static_assert(sizeof(ImDrawVert) % sizeof(float) == 0, "AVX2 text kernels gather ImDrawVert fields in 4 byte units");
+    static_assert(offsetof(ImDrawVert, pos) % sizeof(float) == 0 && offsetof(ImDrawVert, col) % sizeof(float) == 0, "AVX2 text kernels need 4 byte aligned pos/col");
+    ANIMTEXT_TARGET_AVX2 inline __m256i VertexLaneOffsets_AVX2()
+    {
+        const int stride = (int)(sizeof(ImDrawVert) / sizeof(float));
+        return _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(stride));
+    }
+
+    ANIMTEXT_TARGET_AVX2 inline void SineDisplaceY_AVX2(ImDrawVert* v, int count, ImVec2 offset, float x_scale, float phase, float amp)
+    {
+        const __m256 vscale = _mm256_set1_ps(x_scale), vphase = _mm256_set1_ps(phase), vamp = _mm256_set1_ps(amp);
+        const __m256i lanes = VertexLaneOffsets_AVX2();
+        int i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 x = _mm256_i32gather_ps(&v[i].pos.x, lanes, 4);
+            __m256 d = _mm256_mul_ps(vamp, Sin_AVX2(_mm256_add_ps(_mm256_mul_ps(x, vscale), vphase)));
+            alignas(32) float dy[8];
+            _mm256_store_ps(dy, d);
+            for (int n = 0; n < 8; ++n)
+            {
+                v[i + n].pos.x += offset.x;
+                v[i + n].pos.y += offset.y + dy[n];
+            }
+        }
+        SineDisplaceY_Scalar(v + i, count - i, offset, x_scale, phase, amp);
+    }
+
+    ANIMTEXT_TARGET_AVX2 inline void NoiseDisplaceQuads_AVX2(ImDrawVert* v, int quad_count, const ImU32* seeds_x, const ImU32* seeds_y,
+        float t, float speed_x, float speed_y, float roughness, ImVec2 spread)
+    {
+        uint32_t kx, ky; float wx, wy;
+        NoiseStep(t, speed_x, roughness, &kx, &wx);
+        NoiseStep(t, speed_y, roughness, &ky, &wy);
+        const __m256i vkx = _mm256_set1_epi32((int)kx), vky = _mm256_set1_epi32((int)ky), one = _mm256_set1_epi32(1);
+        const __m256 vwx = _mm256_set1_ps(wx), vwy = _mm256_set1_ps(wy);
+        const __m256 vsx = _mm256_set1_ps(spread.x), vsy = _mm256_set1_ps(spread.y), two = _mm256_set1_ps(2.0f), half = _mm256_set1_ps(0.5f), onef = _mm256_set1_ps(1.0f);
+        int q = 0;
+        for (; q + 8 <= quad_count; q += 8)
+        {
+            __m256i sx = _mm256_add_epi32(_mm256_loadu_si256((const __m256i*)(seeds_x + q)), vkx);
+            __m256i sy = _mm256_add_epi32(_mm256_loadu_si256((const __m256i*)(seeds_y + q)), vky);
+            __m256 ax = Hash01_AVX2(sx), bx = Hash01_AVX2(_mm256_add_epi32(sx, one));
+            __m256 ay = Hash01_AVX2(sy), by = Hash01_AVX2(_mm256_add_epi32(sy, one));
+            __m256 nx = _mm256_add_ps(ax, _mm256_mul_ps(_mm256_sub_ps(bx, ax), vwx));
+            __m256 ny = _mm256_add_ps(ay, _mm256_mul_ps(_mm256_sub_ps(by, ay), vwy));
+            __m256 jx = _mm256_floor_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_mul_ps(nx, two), onef), vsx), half));
+            __m256 jy = _mm256_floor_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_mul_ps(ny, two), onef), vsy), half));
+            alignas(32) float dx[8], dy[8];
+            _mm256_store_ps(dx, jx);
+            _mm256_store_ps(dy, jy);
+            for (int n = 0; n < 8; ++n)
+            {
+                ImDrawVert* quad = v + (q + n) * 4;
+                for (int c = 0; c < 4; ++c)
+                {
+                    quad[c].pos.x += dx[n];
+                    quad[c].pos.y += dy[n];
+                }
+            }
+        }
+        NoiseDisplaceQuads_Scalar(v + q * 4, quad_count - q, seeds_x + q, seeds_y + q, t, speed_x, speed_y, roughness, spread);
+    }
+
+    ANIMTEXT_TARGET_AVX2 inline void GradientLutRecolor_AVX2(ImDrawVert* v, int count, ImVec2 offset, const ImU32* lut, int lut_size,
+        float u_scale, float u_bias, float phase, int mode, bool smooth_peaks)
+    {
+        const __m256 vscale = _mm256_set1_ps(u_scale), vbias = _mm256_set1_ps(u_bias);
+        const __m256 idx_scale = _mm256_set1_ps((float)(lut_size - 1)), half = _mm256_set1_ps(0.5f);
+        const __m256i rgb_mask = _mm256_set1_epi32((int)~IM_COL32_A_MASK);
+        const __m256i lanes = VertexLaneOffsets_AVX2();
+        int i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 x = _mm256_i32gather_ps(&v[i].pos.x, lanes, 4);
+            __m256 tval = GradientShape_AVX2(_mm256_add_ps(_mm256_mul_ps(x, vscale), vbias), phase, mode, smooth_peaks);
+            __m256i idx = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(tval, idx_scale), half));
+            __m256i c = _mm256_i32gather_epi32((const int*)lut, idx, 4);
+            __m256i vc = _mm256_i32gather_epi32((const int*)&v[i].col, lanes, 4);
+            __m256i a = MulAlpha255_AVX2(_mm256_srli_epi32(c, IM_COL32_A_SHIFT), _mm256_srli_epi32(vc, IM_COL32_A_SHIFT));
+            alignas(32) ImU32 out[8];
+            _mm256_store_si256((__m256i*)out, _mm256_or_si256(_mm256_and_si256(c, rgb_mask), _mm256_slli_epi32(a, IM_COL32_A_SHIFT)));
+            for (int n = 0; n < 8; ++n)
+            {
+                v[i + n].col = out[n];
+                v[i + n].pos.x += offset.x;
+                v[i + n].pos.y += offset.y;
+            }
+        }
+        GradientLutRecolor_Scalar(v + i, count - i, offset, lut, lut_size, u_scale, u_bias, phase, mode, smooth_peaks);
+    }
+
+    ANIMTEXT_TARGET_AVX2 inline void MultiplyAlpha_AVX2(ImDrawVert* v, int count, float alpha)
+    {
+        const __m256i m = _mm256_set1_epi32((int)(ImClamp(alpha, 0.0f, 1.0f) * 255.0f + 0.5f));
+        const __m256i rgb_mask = _mm256_set1_epi32((int)~IM_COL32_A_MASK);
+        const __m256i lanes = VertexLaneOffsets_AVX2();
+        int i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i vc = _mm256_i32gather_epi32((const int*)&v[i].col, lanes, 4);
+            __m256i a = MulAlpha255_AVX2(_mm256_srli_epi32(vc, IM_COL32_A_SHIFT), m);
+            alignas(32) ImU32 out[8];
+            _mm256_store_si256((__m256i*)out, _mm256_or_si256(_mm256_and_si256(vc, rgb_mask), _mm256_slli_epi32(a, IM_COL32_A_SHIFT)));
+            for (int n = 0; n < 8; ++n)
+                v[i + n].col = out[n];
+        }
+        MultiplyAlpha_Scalar(v + i, count - i, alpha);
+    }
+
+    inline bool CpuHasAVX2()
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7)
+            return false;
+        __cpuid(info, 1);
+        const bool os_saves_ymm = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && ((_xgetbv(0) & 6) == 6); // OSXSAVE + AVX, XMM/YMM state enabled
+        __cpuidex(info, 7, 0);
+        return os_saves_ymm && (info[1] & (1 << 5)) != 0;
+#else
+        return __builtin_cpu_supports("avx2") != 0;
+#endif
+    }
+#endif // ANIMTEXT_KERNELS_AVX2
+
+#ifdef ANIMTEXT_KERNELS_NEON
+    // ---------- NEON (4 lanes) ----------
+    inline float32x4_t Floor_NEON(float32x4_t x)
+    {
+        float32x4_t t = vcvtq_f32_s32(vcvtq_s32_f32(x));
+        return vsubq_f32(t, vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(t, x), vreinterpretq_u32_f32(vdupq_n_f32(1.0f)))));
+    }
+
+    inline float32x4_t Sin_NEON(float32x4_t x)
+    {
+        float32x4_t r = vmulq_n_f32(x, kInvTwoPi);
+        r = vsubq_f32(r, Floor_NEON(vaddq_f32(r, vdupq_n_f32(0.5f))));
+        r = vminq_f32(r, vsubq_f32(vdupq_n_f32(0.5f), r));
+        r = vmaxq_f32(r, vsubq_f32(vdupq_n_f32(-0.5f), r));
+        float32x4_t a = vmulq_n_f32(r, kTwoPi);
+        float32x4_t a2 = vmulq_f32(a, a);
+        float32x4_t p = vmlaq_f32(vdupq_n_f32(kSinC7), a2, vdupq_n_f32(kSinC9));
+        p = vmlaq_f32(vdupq_n_f32(kSinC5), a2, p);
+        p = vmlaq_f32(vdupq_n_f32(kSinC3), a2, p);
+        p = vmlaq_f32(vdupq_n_f32(1.0f), a2, p);
+        return vmulq_f32(a, p);
+    }
+
+    inline float32x4_t Hash01_NEON(uint32x4_t x)
+    {
+        x = veorq_u32(x, vmulq_n_u32(x, 0x27d4eb2d));
+        x = veorq_u32(x, vshrq_n_u32(x, 15)); x = vmulq_n_u32(x, 0x85ebca6b);
+        x = veorq_u32(x, vshrq_n_u32(x, 13)); x = vmulq_n_u32(x, 0xc2b2ae35);
+        x = veorq_u32(x, vshrq_n_u32(x, 16));
+        return vmulq_n_f32(vcvtq_f32_u32(vandq_u32(x, vdupq_n_u32(0x00FFFFFF))), 1.0f / 16777216.0f);
+    }
+
+    inline float32x4_t GradientShape_NEON(float32x4_t u, float phase, int mode, bool smooth_peaks)
+    {
+        if (mode == 0)
+            return vminq_f32(vmaxq_f32(u, vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f));
+        float32x4_t s = vaddq_f32(u, vdupq_n_f32(phase));
+        s = vsubq_f32(s, Floor_NEON(s));
+        if (mode == 1)
+            return s;
+        float32x4_t tri = vsubq_f32(vdupq_n_f32(1.0f), vabsq_f32(vsubq_f32(vaddq_f32(s, s), vdupq_n_f32(1.0f))));
+        if (smooth_peaks)
+            tri = vmulq_f32(vmulq_f32(tri, tri), vsubq_f32(vdupq_n_f32(3.0f), vaddq_f32(tri, tri)));
+        return tri;
+    }
+
+    inline uint32x4_t MulAlpha255_NEON(uint32x4_t a, uint32x4_t b)
+    {
+        uint32x4_t p = vaddq_u32(vmulq_u32(a, b), vdupq_n_u32(128));
+        return vshrq_n_u32(vaddq_u32(p, vshrq_n_u32(p, 8)), 8);
+    }
+
+    inline void SineDisplaceY_NEON(ImDrawVert* v, int count, ImVec2 offset, float x_scale, float phase, float amp)
+    {
+        int i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const float xs[4] = { v[i].pos.x, v[i + 1].pos.x, v[i + 2].pos.x, v[i + 3].pos.x };
+            float32x4_t d = vmulq_n_f32(Sin_NEON(vaddq_f32(vmulq_n_f32(vld1q_f32(xs), x_scale), vdupq_n_f32(phase))), amp);
+            float dy[4];
+            vst1q_f32(dy, d);
+            for (int n = 0; n < 4; ++n)
+            {
+                v[i + n].pos.x += offset.x;
+                v[i + n].pos.y += offset.y + dy[n];
+            }
+        }
+        SineDisplaceY_Scalar(v + i, count - i, offset, x_scale, phase, amp);
+    }
+
+    inline void NoiseDisplaceQuads_NEON(ImDrawVert* v, int quad_count, const ImU32* seeds_x, const ImU32* seeds_y,
+        float t, float speed_x, float speed_y, float roughness, ImVec2 spread)
+    {
+        uint32_t kx, ky; float wx, wy;
+        NoiseStep(t, speed_x, roughness, &kx, &wx);
+        NoiseStep(t, speed_y, roughness, &ky, &wy);
+        int q = 0;
+        for (; q + 4 <= quad_count; q += 4)
+        {
+            uint32x4_t sx = vaddq_u32(vld1q_u32(seeds_x + q), vdupq_n_u32(kx));
+            uint32x4_t sy = vaddq_u32(vld1q_u32(seeds_y + q), vdupq_n_u32(ky));
+            float32x4_t ax = Hash01_NEON(sx), bx = Hash01_NEON(vaddq_u32(sx, vdupq_n_u32(1)));
+            float32x4_t ay = Hash01_NEON(sy), by = Hash01_NEON(vaddq_u32(sy, vdupq_n_u32(1)));
+            float32x4_t nx = vmlaq_n_f32(ax, vsubq_f32(bx, ax), wx);
+            float32x4_t ny = vmlaq_n_f32(ay, vsubq_f32(by, ay), wy);
+            float32x4_t jx = Floor_NEON(vaddq_f32(vmulq_n_f32(vsubq_f32(vmulq_n_f32(nx, 2.0f), vdupq_n_f32(1.0f)), spread.x), vdupq_n_f32(0.5f)));
+            float32x4_t jy = Floor_NEON(vaddq_f32(vmulq_n_f32(vsubq_f32(vmulq_n_f32(ny, 2.0f), vdupq_n_f32(1.0f)), spread.y), vdupq_n_f32(0.5f)));
+            float dx[4], dy[4];
+            vst1q_f32(dx, jx);
+            vst1q_f32(dy, jy);
+            for (int n = 0; n < 4; ++n)
+            {
+                ImDrawVert* quad = v + (q + n) * 4;
+                for (int c = 0; c < 4; ++c)
+                {
+                    quad[c].pos.x += dx[n];
+                    quad[c].pos.y += dy[n];
+                }
+            }
+        }
+        NoiseDisplaceQuads_Scalar(v + q * 4, quad_count - q, seeds_x + q, seeds_y + q, t, speed_x, speed_y, roughness, spread);
+    }
+
+    inline void GradientLutRecolor_NEON(ImDrawVert* v, int count, ImVec2 offset, const ImU32* lut, int lut_size,
+        float u_scale, float u_bias, float phase, int mode, bool smooth_peaks)
+    {
+        const float idx_scale = (float)(lut_size - 1);
+        int i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const float xs[4] = { v[i].pos.x, v[i + 1].pos.x, v[i + 2].pos.x, v[i + 3].pos.x };
+            float32x4_t tval = GradientShape_NEON(vaddq_f32(vmulq_n_f32(vld1q_f32(xs), u_scale), vdupq_n_f32(u_bias)), phase, mode, smooth_peaks);
+            int32_t idx[4];
+            vst1q_s32(idx, vcvtq_s32_f32(vaddq_f32(vmulq_n_f32(tval, idx_scale), vdupq_n_f32(0.5f))));
+            const ImU32 cs[4] = { lut[idx[0]], lut[idx[1]], lut[idx[2]], lut[idx[3]] };
+            const ImU32 vcs[4] = { v[i].col, v[i + 1].col, v[i + 2].col, v[i + 3].col };
+            uint32x4_t c = vld1q_u32(cs);
+            uint32x4_t a = MulAlpha255_NEON(vshrq_n_u32(c, IM_COL32_A_SHIFT), vshrq_n_u32(vld1q_u32(vcs), IM_COL32_A_SHIFT));
+            ImU32 out[4];
+            vst1q_u32(out, vorrq_u32(vandq_u32(c, vdupq_n_u32(~IM_COL32_A_MASK)), vshlq_n_u32(a, IM_COL32_A_SHIFT)));
+            for (int n = 0; n < 4; ++n)
+            {
+                v[i + n].col = out[n];
+                v[i + n].pos.x += offset.x;
+                v[i + n].pos.y += offset.y;
+            }
+        }
+        GradientLutRecolor_Scalar(v + i, count - i, offset, lut, lut_size, u_scale, u_bias, phase, mode, smooth_peaks);
+    }
+
+    inline void MultiplyAlpha_NEON(ImDrawVert* v, int count, float alpha)
+    {
+        const uint32x4_t m = vdupq_n_u32((uint32_t)(ImClamp(alpha, 0.0f, 1.0f) * 255.0f + 0.5f));
+        int i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const ImU32 vcs[4] = { v[i].col, v[i + 1].col, v[i + 2].col, v[i + 3].col };
+            uint32x4_t vc = vld1q_u32(vcs);
+            uint32x4_t a = MulAlpha255_NEON(vshrq_n_u32(vc, IM_COL32_A_SHIFT), m);
+            ImU32 out[4];
+            vst1q_u32(out, vorrq_u32(vandq_u32(vc, vdupq_n_u32(~IM_COL32_A_MASK)), vshlq_n_u32(a, IM_COL32_A_SHIFT)));
+            for (int n = 0; n < 4; ++n)
+                v[i + n].col = out[n];
+        }
+        MultiplyAlpha_Scalar(v + i, count - i, alpha);
+    }
+#endif // ANIMTEXT_KERNELS_NEON
+
+    // ---------- SELECTION ----------
+    inline bool IsLevelSupported(KernelLevel level)
+    {
+        switch (level)
+        {
+        case KernelLevel_Scalar: return true;
+#ifdef ANIMTEXT_KERNELS_SSE2
+        case KernelLevel_SSE2: return true;
+#endif
+#ifdef ANIMTEXT_KERNELS_AVX2
+        case KernelLevel_AVX2: { static const bool has_avx2 = CpuHasAVX2(); return has_avx2; }
+#endif
+#ifdef ANIMTEXT_KERNELS_NEON
+        case KernelLevel_NEON: return true;
+#endif
+        default: return false;
+        }
+    }
+
+    inline KernelTable MakeKernelTable(KernelLevel level)
+    {
+        KernelTable k = { KernelLevel_Scalar, "Scalar", SineDisplaceY_Scalar, NoiseDisplaceQuads_Scalar, GradientLutRecolor_Scalar, MultiplyAlpha_Scalar };
+        switch (level)
+        {
+#ifdef ANIMTEXT_KERNELS_SSE2
+        case KernelLevel_SSE2: k = { KernelLevel_SSE2, "SSE2", SineDisplaceY_SSE2, NoiseDisplaceQuads_SSE2, GradientLutRecolor_SSE2, MultiplyAlpha_SSE2 }; break;
+#endif
+#ifdef ANIMTEXT_KERNELS_AVX2
+        case KernelLevel_AVX2: k = { KernelLevel_AVX2, "AVX2", SineDisplaceY_AVX2, NoiseDisplaceQuads_AVX2, GradientLutRecolor_AVX2, MultiplyAlpha_AVX2 }; break;
+#endif
+#ifdef ANIMTEXT_KERNELS_NEON
+        case KernelLevel_NEON: k = { KernelLevel_NEON, "NEON", SineDisplaceY_NEON, NoiseDisplaceQuads_NEON, GradientLutRecolor_NEON, MultiplyAlpha_NEON }; break;
+#endif
+        default: break;
+        }
+        return k;
+    }
+
+    inline KernelLevel BestSupportedLevel()
+    {
+        for (KernelLevel level = KernelLevel_COUNT - 1; level > KernelLevel_Scalar; --level)
+            if (IsLevelSupported(level))
+                return level;
+        return KernelLevel_Scalar;
+    }
+
+    inline KernelTable& ActiveKernelTable()
+    {
+        static KernelTable s_table = MakeKernelTable(BestSupportedLevel());
+        return s_table;
+    }
+
+    // Kernels used by the text effects
+    inline const KernelTable& Get() { return ActiveKernelTable(); }
+
+    // Forces a kernel level (e.g. to compare them), KernelLevel_Auto goes back to the best one. Returns false if the level is not supported here.
+    inline bool SetLevel(KernelLevel level)
+    {
+        if (level == KernelLevel_Auto)
+            level = BestSupportedLevel();
+        if (!IsLevelSupported(level))
+            return false;
+        ActiveKernelTable() = MakeKernelTable(level);
+        return true;
+    }
+}
@@ -2,6 +2,8 @@
 #include <imgui.h>
 #include <imgui_internal.h>
 #include "easing.h"
+#include "imguiContextData.h"
+#include "imguiAnimClock.h"
 
 namespace ImGui
 {
@@ -72,6 +74,8 @@ namespace ImGui
             ImGuiStorage* st = GetStateStorage();
             const ImGuiID kDisplay = id;
             const ImGuiID kLastTime = id + 10;
+            const ImGuiID keys[] = { kDisplay, kLastTime, StorageTimeKeyHi(kLastTime) };
+            TouchWidgetState(window, id, keys, IM_ARRAYSIZE(keys));
 
             const float kEps = 1e-5f;
             const bool snap_up = cfg.snap_finish && (target >= 1.0f - kEps);
@@ -82,16 +86,15 @@ namespace ImGui
                 // Snap to the endpoint immediately
                 display = target;
                 st->SetFloat(kDisplay, display);
-                st->SetFloat(kLastTime, (float)g.Time);
+                StorageSetTime(st, kLastTime, GetAnimTime());
             }
             else
             {
                 // Continuous chase integrator (stable when target moves every frame)
                 float prev_display = st->GetFloat(kDisplay, target);
-                float last_time = st->GetFloat(kLastTime, (float)g.Time);
-
-                float now = (float)g.Time;
-                float dt = ImMax(0.0f, now - last_time);
+                const double now = GetAnimTime();
+                const double last_time = StorageGetTime(st, kLastTime, now);
+                float dt = ImMax(0.0f, AnimClock::Since(now, last_time));
 
                 // Convert "duration to feel mostly there" into an exponential smoothing factor
                 float tau = ImMax(1e-6f, cfg.smooth_duration);
@@ -99,9 +102,11 @@ namespace ImGui
                 float w = alpha;
 
                 display = ImLerp(prev_display, target, w);
+                if (fabsf(display - target) > 1e-4f)
+                    AnimActiveNextFrame(); // still chasing the target
 
                 st->SetFloat(kDisplay, display);
-                st->SetFloat(kLastTime, now);
+                StorageSetTime(st, kLastTime, now);
             }
         }
 
@@ -127,7 +132,6 @@ namespace ImGui
         {
             const float r = size.y * 0.5f;
             const float period = (cfg.circle_period > 0.0f) ? cfg.circle_period : 1e-6f;
-            const float t = (float)g.Time;
 
             // The dot travels across [circle_start..circle_end] plus one radius of overshoot,
             // so it fully disappears at the right edge before wrapping.
@@ -136,8 +140,8 @@ namespace ImGui
             // Stagger phases evenly across the loop
             for (int i = 0; i < cfg.num_circles; ++i)
             {
-                float shift = (period / ImMax(1, cfg.num_circles)) * i;
-                float phase = fmodf(t + shift, period) / period;       // [0..1)
+                float shift = (float)i / ImMax(1, cfg.num_circles);
+                float phase = AnimPhase(1.0 / period, shift);          // [0..1)
                 float x = pos.x + circle_end - phase * travel;
                 ImVec2 c = ImVec2(x, bb.Min.y + r);
                 window->DrawList->AddCircleFilled(c, r, col_circles);
@@ -0,0 +1,261 @@
+#pragma once
+#include <math.h>
+#include <imgui.h>
+#include <imgui_internal.h>
+#include "imguiContextData.h"
+#include "imguiAnimClock.h"
+
+// Critically damped springs: values that follow a target, which may change every frame, without overshoot.
+// Unlike Tween there is no duration: when the target changes mid-way the value keeps its velocity and curves
+// towards the new target. Springs advance in fixed steps of SPRING_FIXED_STEP seconds on a clock shared by
+// every spring of the context, so they move the same way at any frame rate; the part of a step left over at
+// the end of a frame is evaluated for display only.
+namespace ImGui
+{
+	static float SPRING_FIXED_STEP = 1.0f / 120.0f;  // seconds per integration step
+	static int   SPRING_MAX_STEPS = 64;              // steps a spring catches up one by one, past that it jumps in one exact step
+	static int   SPRING_STALE_FRAMES = 600;          // a spring not submitted for this many frames is reclaimed (it restarts at its target)
+	static int   SPRING_SWEEP_PER_FRAME = 64;        // spring slots checked for staleness per frame
+	static float SPRING_REST_EPSILON = 1e-3f;        // a spring this close to its target and this slow (per second) is at rest and stops requesting frames
+
+	namespace SpringDetail
+	{
+		template<typename T> struct Dim;
+		template<> struct Dim<float>  { enum { N = 1 }; };
+		template<> struct Dim<ImVec2> { enum { N = 2 }; };
+		template<> struct Dim<ImVec4> { enum { N = 4 }; };
+
+		// Per step constants of a critically damped spring with a given half-life (time to halve the distance to the target)
+		struct Coeffs
+		{
+			float W;      // damping = stiffness root
+			float WH;     // W * SPRING_FIXED_STEP
+			float E;      // exp(-W * SPRING_FIXED_STEP)
+
+			Coeffs(float halflife)
+			{
+				W = 1.67834699f / ImMax(halflife, 1e-4f); // a = W * halflife solves (1 + a) e^-a = 1/2, starting at rest
+				WH = W * SPRING_FIXED_STEP;
+				E = expf(-WH);
+			}
+		};
+
+		// Exact solution over dt towards a fixed target: x = target + (j0 + j1 t) e^-wt
+		static inline void Step(float& x, float& v, float target, float w, float wdt, float e, float dt)
+		{
+			const float j0 = x - target;
+			const float j1 = v + j0 * w;
+			x = target + (j0 + j1 * dt) * e;
+			v = (v - j1 * wdt) * e;
+		}
+
+		// State of every spring of one value size, as packed arrays indexed through an ID -> slot map.
+		// A slot holds N positions and N velocities, the fixed step it was last advanced to and the frame it was last submitted.
+		template<int N>
+		struct SpringPool
+		{
+			IDSlotMap         Map;
+			ImVector<ImGuiID> Ids;
+			ImVector<ImU32>   StepIndex;
+			ImVector<int>     LastFrame;
+			ImVector<float>   Pos;     // N per slot
+			ImVector<float>   Vel;     // N per slot
+			// Shared clock
+			int               Frame = -1;
+			double            Epoch = -1.0;
+			ImU32             Steps = 0;         // fixed steps elapsed since Epoch (wraps, only differences are used)
+			float             Remainder = 0.0f;  // time past the last whole step
+			int               SweepCursor = 0;
+			int               ReclaimedTotal = 0;
+
+			int Size() const { return Ids.Size; }
+
+			void BeginFrame()
+			{
+				ImGuiContext& g = *GImGui;
+				if (Frame == g.FrameCount)
+					return;
+				Frame = g.FrameCount;
+				const double now = GetAnimTime();
+				if (Epoch < 0.0)
+					Epoch = now;
+				const double steps = floor((now - Epoch) / SPRING_FIXED_STEP);
+				Steps = (ImU32)(ImU64)steps;
+				Remainder = (float)(now - Epoch - steps * SPRING_FIXED_STEP);
+				Sweep(g.FrameCount, SPRING_STALE_FRAMES, SPRING_SWEEP_PER_FRAME);
+			}
+
+			// Slot of key, created at rest on initial when missing
+			int Touch(ImGuiID key, const float* initial)
+			{
+				int slot = Map.Find(key);
+				if (slot < 0)
+				{
+					slot = Ids.Size;
+					Ids.push_back(key);
+					StepIndex.push_back(Steps);
+					LastFrame.push_back(Frame);
+					for (int c = 0; c < N; ++c)
+					{
+						Pos.push_back(initial[c]);
+						Vel.push_back(0.0f);
+					}
+					Map.Insert(key, slot);
+				}
+				LastFrame[slot] = Frame;
+				return slot;
+			}
+
+			// Advances slot to the current step towards target, then writes the value at the current time to out.
+			// Returns true while the spring is not at rest.
+			bool Advance(int slot, const float* target, float* out, const Coeffs& k, float out_e)
+			{
+				float* x = Pos.Data + slot * N;
+				float* v = Vel.Data + slot * N;
+				const ImU32 steps = Steps - StepIndex[slot];
+				StepIndex[slot] = Steps;
+				if (steps > (ImU32)SPRING_MAX_STEPS)
+				{
+					const float dt = steps * SPRING_FIXED_STEP;
+					const float e = expf(-k.W * dt);
+					for (int c = 0; c < N; ++c)
+						Step(x[c], v[c], target[c], k.W, k.W * dt, e, dt);
+				}
+				else
+				{
+					for (ImU32 s = 0; s < steps; ++s)
+						for (int c = 0; c < N; ++c)
+							Step(x[c], v[c], target[c], k.W, k.WH, k.E, SPRING_FIXED_STEP);
+				}
+				bool moving = false;
+				for (int c = 0; c < N; ++c)
+				{
+					moving |= fabsf(x[c] - target[c]) > SPRING_REST_EPSILON || fabsf(v[c]) > SPRING_REST_EPSILON;
+					float xc = x[c], vc = v[c];
+					Step(xc, vc, target[c], k.W, k.W * Remainder, out_e, Remainder);
+					out[c] = xc;
+				}
+				return moving;
+			}
+
+			void Remove(int slot)
+			{
+				const int last = Ids.Size - 1;
+				Map.Remove(Ids[slot]);
+				if (slot != last)
+				{
+					Ids[slot] = Ids[last];
+					StepIndex[slot] = StepIndex[last];
+					LastFrame[slot] = LastFrame[last];
+					for (int c = 0; c < N; ++c)
+					{
+						Pos[slot * N + c] = Pos[last * N + c];
+						Vel[slot * N + c] = Vel[last * N + c];
+					}
+					Map.Insert(Ids[slot], slot);
+				}
+				Ids.pop_back(); StepIndex.pop_back(); LastFrame.pop_back();
+				Pos.resize(Pos.Size - N); Vel.resize(Vel.Size - N);
+			}
+
+			// Removes up to max_checks slots (round robin) not submitted within max_idle_frames. Returns how many were removed.
+			int Sweep(int frame, int max_idle_frames, int max_checks)
+			{
+				int removed = 0;
+				for (int n = 0; n < max_checks && Ids.Size > 0; ++n)
+				{
+					if (SweepCursor >= Ids.Size)
+						SweepCursor = 0;
+					if (frame - LastFrame[SweepCursor] > max_idle_frames)
+					{
+						Remove(SweepCursor); // the swapped in slot is checked next
+						removed++;
+						ReclaimedTotal++;
+					}
+					else
+						SweepCursor++;
+				}
+				return removed;
+			}
+		};
+
+		template<int N>
+		inline SpringPool<N>& GetSpringPool()
+		{
+			static const ImGuiID owner = ImHashStr("##SpringPool", 0, (ImGuiID)N);
+			SpringPool<N>& pool = *GetContextData<SpringPool<N>>(owner);
+			pool.BeginFrame();
+			return pool;
+		}
+	}
+
+	// Follows target with a critically damped spring. halflife: seconds for the distance to the target to halve.
+	// A new spring starts at rest on its target. T: float, ImVec2 or ImVec4.
+	template<typename T>
+	inline T Spring(const char* id, const T& target, float halflife = 0.08f)
+	{
+		constexpr int N = SpringDetail::Dim<T>::N;
+		ImGuiWindow* window = ImGui::GetCurrentWindowRead();
+		SpringDetail::SpringPool<N>& pool = SpringDetail::GetSpringPool<N>();
+		const SpringDetail::Coeffs k(halflife);
+		const float out_e = expf(-k.W * pool.Remainder);
+		T out;
+		const int slot = pool.Touch(window->GetID(id), (const float*)&target);
+		if (pool.Advance(slot, (const float*)&target, (float*)&out, k, out_e))
+			AnimActiveNextFrame();
+		return out;
+	}
+
+	// count springs at once, e.g. the rows of a list being reordered. ids: one per follower, stable across frames
+	// (e.g. a hash of the item it animates, not its index), scoped to the current window. The per step constants
+	// are computed once for the whole batch. out may alias targets.
+	template<typename T>
+	inline void SpringBatch(const ImGuiID* ids, const T* targets, T* out, int count, float halflife = 0.08f)
+	{
+		constexpr int N = SpringDetail::Dim<T>::N;
+		ImGuiWindow* window = ImGui::GetCurrentWindowRead();
+		SpringDetail::SpringPool<N>& pool = SpringDetail::GetSpringPool<N>();
+		const SpringDetail::Coeffs k(halflife);
+		const float out_e = expf(-k.W * pool.Remainder);
+		bool moving = false;
+		for (int i = 0; i < count; ++i)
+		{
+			ImGuiID key = ImHashData(&ids[i], sizeof(ImGuiID), window->ID);
+			const float* target = (const float*)&targets[i];
+			const int slot = pool.Touch(key ? key : 1, target);
+			moving |= pool.Advance(slot, target, (float*)&out[i], k, out_e);
+		}
+		if (moving)
+			AnimActiveNextFrame();
+	}
+
+	// Moves the spring id to value with the given velocity (units per second), e.g. to give it a kick
+	template<typename T>
+	inline void SetSpring(const char* id, const T& value, const T& velocity = T())
+	{
+		constexpr int N = SpringDetail::Dim<T>::N;
+		ImGuiWindow* window = ImGui::GetCurrentWindowRead();
+		SpringDetail::SpringPool<N>& pool = SpringDetail::GetSpringPool<N>();
+		const int slot = pool.Touch(window->GetID(id), (const float*)&value);
+		for (int c = 0; c < N; ++c)
+		{
+			pool.Pos[slot * N + c] = ((const float*)&value)[c];
+			pool.Vel[slot * N + c] = ((const float*)&velocity)[c];
+		}
+		pool.StepIndex[slot] = pool.Steps;
+		AnimActiveNextFrame();
+	}
+
+	// Drops the state of every spring not submitted within max_idle_frames frames (default SPRING_STALE_FRAMES)
+	// right away, instead of waiting for the incremental sweep. Returns how many were reclaimed.
+	inline int GcSprings(int max_idle_frames = -1)
+	{
+		const int frames = max_idle_frames >= 0 ? max_idle_frames : SPRING_STALE_FRAMES;
+		const int frame = GImGui->FrameCount;
+		SpringDetail::SpringPool<1>& p1 = SpringDetail::GetSpringPool<1>();
+		SpringDetail::SpringPool<2>& p2 = SpringDetail::GetSpringPool<2>();
+		SpringDetail::SpringPool<4>& p4 = SpringDetail::GetSpringPool<4>();
+		p1.SweepCursor = p2.SweepCursor = p4.SweepCursor = 0;
+		return p1.Sweep(frame, frames, p1.Size()) + p2.Sweep(frame, frames, p2.Size()) + p4.Sweep(frame, frames, p4.Size());
+	}
+}
@@ -2,17 +2,62 @@
 #include <string>
 #include <imgui.h>
 #include <imgui_internal.h>
+#include <cstdio>
+#include <cmath>
+#include <climits>
+#include <locale>
+#include "imguiContextData.h"
 
 namespace
 {
 struct TextWrappedLimitedCacheEntry
 {
-	float wrap_width = 0.0f;
-	float max_height = 0.0f;
-	std::string input;
-	std::string output;
-	std::string cutoff;
-	int last_frame_used = 0;
+	ImU64  text_hash = 0;
+	float  wrap_width = 0.0f;
+	float  max_height = 0.0f;
+	ImFont* font = nullptr;
+	float  font_size = 0.0f;
+	bool   truncated = false;
+	int    cut = 0;           // byte offset of the cut point into the source text, the hidden tail starts here
+	ImVector<char> output;    // kept text + "...", capacity is kept between recalculations
+};
+
+struct TextLimitedCacheEntry
+{
+	ImU64  text_hash = 0;
+	float  avail = -1.0f;
+	ImFont* font = nullptr;
+	float  font_size = 0.0f;
+	bool   cut_left = false;
+	bool   truncated = false;
+	int    cut = 0;           // byte offset of the cut point into the source text
+	ImVector<char> output;    // ellipsized text, capacity is kept between recalculations
+};
+
+struct TextMiddleCacheEntry
+{
+	ImU64  text_hash = 0;
+	float  avail = -1.0f;
+	ImFont* font = nullptr;
+	float  font_size = 0.0f;
+	const char* separators = nullptr;
+	bool   truncated = false;
+	int    head_end = 0;      // byte offset where the hidden middle starts
+	int    tail_begin = 0;    // byte offset where the kept tail starts
+	ImVector<char> output;    // head + "..." + tail, capacity is kept between recalculations
+};
+
+// Per-context result caches. Entries are keyed by item ID and validated against a hash of the text,
+// so no copy of the input is kept. The caches are bounded and recycle their least recently used entry.
+struct TextFormatsCache
+{
+	ImGui::IDLruCache<TextLimitedCacheEntry>        Limited;
+	ImGui::IDLruCache<TextWrappedLimitedCacheEntry> WrappedLimited;
+	ImGui::IDLruCache<TextMiddleCacheEntry>         Middle;
+
+	// Scratch for EllipsizeMiddleFitPos, reused by every call so measuring does not allocate once warmed up
+	ImVector<float> PrefixX;       // PrefixX[i] = width of the first i codepoints
+	ImVector<int>   PrefixOffsets; // PrefixOffsets[i] = byte offset of codepoint i
 };
 }
 
@@ -28,79 +73,101 @@ enum TextLimitedFlags_
 namespace ImGui
 {
 	static float MINIMUM_TOOLTIP_WIDTH_MULTIPLIER = 20.0f; // modify this to change the minimum width of the tooltip in terms of characters
-	static std::string EllipsizeRightFit(const char* text, float max_width, std::string* out_cutoff = nullptr)
-	{
-		if (out_cutoff) out_cutoff->clear();
-		const char* dots = "...";
+	static int   TEXT_FORMATS_CACHE_CAPACITY = 1024;       // modify this (before first use) to change how many entries each per-context text cache holds
 
-		if (!text) return {};
-		if (max_width <= 0.0f) return dots;
+	static TextFormatsCache& GetTextFormatsCache()
+	{
+		static const ImGuiID owner = ImHashStr("##TextFormatsCache");
+		TextFormatsCache* cache = ImGui::GetContextData<TextFormatsCache>(owner);
+		if (cache->Limited.Capacity() == 0)
+		{
+			cache->Limited.Init(TEXT_FORMATS_CACHE_CAPACITY);
+			cache->WrappedLimited.Init(TEXT_FORMATS_CACHE_CAPACITY);
+			cache->Middle.Init(TEXT_FORMATS_CACHE_CAPACITY);
+		}
+		return *cache;
+	}
 
-		ImVec2 full = ImGui::CalcTextSize(text);
-		if (full.x <= max_width) return text;
+	// Allocation-free core of EllipsizeRightFit: returns the end of the prefix to keep before "...",
+	// or text_end if the whole text already fits.
+	static const char* EllipsizeRightFitPos(const char* text, const char* text_end, float max_width)
+	{
+		if (max_width <= 0.0f) return text;
+		if (ImGui::CalcTextSize(text, text_end).x <= max_width) return text_end;
 
-		float dots_w = ImGui::CalcTextSize(dots).x;
-		float target_w = max_width - dots_w;
-		if (target_w <= 0.0f) return std::string(dots);
+		float target_w = max_width - ImGui::CalcTextSize("...").x;
+		if (target_w <= 0.0f) return text;
 
 		const char* p = text;
 		const char* last_good = text;
 		float w = 0.0f;
-		while (*p)
+		while (p < text_end)
 		{
 			const char* prev = p;
 			unsigned char c = (unsigned char)*p++;
-			if (c & 0x80) while ((*p & 0xC0) == 0x80) p++; // advance over UTF-8 continuation bytes
+			if (c & 0x80) while (p < text_end && (*p & 0xC0) == 0x80) p++; // advance over UTF-8 continuation bytes
 
 			w += ImGui::CalcTextSize(prev, p).x;
 			if (w > target_w) break;
 			last_good = p;
 		}
+		return last_good;
+	}
+	// Allocation-free core of EllipsizeLeftFit: returns the start of the suffix to keep after "...",
+	// or text if the whole text already fits.
+	static const char* EllipsizeLeftFitPos(const char* text, const char* text_end, float max_width)
+	{
+		if (max_width <= 0.0f) return text_end;
+		if (ImGui::CalcTextSize(text, text_end).x <= max_width) return text;
+
+		float target_w = max_width - ImGui::CalcTextSize("...").x;
+		if (target_w <= 0.0f) return text_end;
+
+		const char* first_to_keep = text_end;
+		float w = 0.0f;
+		while (first_to_keep > text)
+		{
+			const char* p = first_to_keep;
+			do { --p; } while (p > text && ((*p & 0xC0) == 0x80)); // step back one UTF-8 codepoint
+
+			w += ImGui::CalcTextSize(p, first_to_keep).x;
+			if (w > target_w) break;
+			first_to_keep = p;
+		}
+		return first_to_keep;
+	}
+
+	static std::string EllipsizeRightFit(const char* text, float max_width, std::string* out_cutoff = nullptr)
+	{
+		if (out_cutoff) out_cutoff->clear();
+		if (!text) return {};
 
 		const char* text_end = text + strlen(text);
+		const char* last_good = EllipsizeRightFitPos(text, text_end, max_width);
+		if (last_good == text_end)
+			return text;
 
-		if (out_cutoff && last_good < text_end)
+		if (out_cutoff)
 			*out_cutoff = std::string(last_good, text_end); // hidden suffix
 
 		std::string out(text, last_good);
-		out += dots;
+		out += "...";
 		return out;
 	}
 	static std::string EllipsizeLeftFit(const char* text, float max_width, std::string* out_cutoff = nullptr)
 	{
 		if (out_cutoff) out_cutoff->clear();
-		const char* dots = "...";
-
 		if (!text) return {};
-		if (max_width <= 0.0f) return dots;
-
-		ImVec2 full = ImGui::CalcTextSize(text);
-		if (full.x <= max_width) return text;
 
-		float dots_w = ImGui::CalcTextSize(dots).x;
-		float target_w = max_width - dots_w;
-		if (target_w <= 0.0f) return std::string(dots);
-
-		const char* begin = text;
-		const char* end = text;
-		while (*end) end++;
-
-		const char* first_to_keep = end;
-		float w = 0.0f;
-		while (first_to_keep > begin)
-		{
-			const char* p = first_to_keep;
-			do { --p; } while (p > begin && ((*p & 0xC0) == 0x80)); // step back one UTF-8 codepoint
-
-			w += ImGui::CalcTextSize(p, first_to_keep).x;
-			if (w > target_w) break;
-			first_to_keep = p;
-		}
+		const char* text_end = text + strlen(text);
+		const char* first_to_keep = EllipsizeLeftFitPos(text, text_end, max_width);
+		if (first_to_keep == text)
+			return text;
 
-		if (out_cutoff && first_to_keep > begin)
-			*out_cutoff = std::string(begin, first_to_keep); // hidden prefix
+		if (out_cutoff)
+			*out_cutoff = std::string(text, first_to_keep); // hidden prefix
 
-		return std::string("...") + std::string(first_to_keep, end);
+		return std::string("...") + std::string(first_to_keep, text_end);
 	}
 
 	// Draw text that is limited to a maximum width, adding "..." as needed.
@@ -168,66 +235,431 @@ namespace ImGui
 		va_end(args);
 	}
 
-	static std::string EllipsizeMultilineFit(const char* text, float wrap_width, float max_height, std::string* out_cutoff = nullptr)
+	// Same as TextLimited, but the ellipsized result is cached per ID and only recomputed when the text, width or font changes.
+	// Meant for large tables/lists (e.g. with ImGuiListClipper) where the same cells are redrawn every frame.
+	// A steady-state frame does not allocate: text that fits is drawn in place and the ellipsized buffer is reused.
+	inline void TextLimitedCached(
+		const char* itemID, // must be stable and unique per text instance (e.g. PushID(row) + "name")
+		const char* text,
+		bool cut_left = false,
+		float max_width = -1.0f,
+		float padding_px = 0.0f,
+		TextLimitedFlags flags = TextLimitedFlags_TooltipShowAll)
 	{
-		const char* dots = "...";
-		if (out_cutoff) out_cutoff->clear();
+		ImGuiWindow* window = ImGui::GetCurrentWindow();
+		if (window->SkipItems)
+			return;
+
 		if (!text)
-			return {};
-		if (wrap_width <= 0.0f || max_height <= 0.0f)
-			return dots;
+			text = "";
+		const char* text_end = text + strlen(text);
+
+		float avail = (max_width >= 0.0f ? max_width : ImGui::GetContentRegionAvail().x) - padding_px;
+		if (avail < 0.0f) avail = 0.0f;
+
+		ImGuiContext& g = *GImGui;
+		ImGuiID id = window->GetID(itemID);
+		bool created = false;
+		TextLimitedCacheEntry& entry = GetTextFormatsCache().Limited.Get(id, &created);
+
+		const ImU64 hash = TextHash64(text, text_end);
+		bool need_recalc =
+			created ||
+			entry.text_hash != hash ||
+			entry.cut_left != cut_left ||
+			entry.font != g.Font ||
+			entry.font_size != g.FontSize ||
+			fabsf(entry.avail - avail) > 0.5f;
+		if (need_recalc)
+		{
+			entry.text_hash = hash;
+			entry.cut_left = cut_left;
+			entry.font = g.Font;
+			entry.font_size = g.FontSize;
+			entry.avail = avail;
+
+			const char* cut = cut_left ? EllipsizeLeftFitPos(text, text_end, avail) : EllipsizeRightFitPos(text, text_end, avail);
+			entry.truncated = cut_left ? (cut != text) : (cut != text_end);
+			entry.cut = (int)(cut - text);
+			entry.output.resize(0);
+			if (entry.truncated)
+			{
+				const char* keep_begin = cut_left ? cut : text;
+				const char* keep_end = cut_left ? text_end : cut;
+				const int keep_len = (int)(keep_end - keep_begin);
+				entry.output.resize(keep_len + 3);
+				char* dst = entry.output.Data;
+				if (cut_left) { memcpy(dst, "...", 3); dst += 3; }
+				memcpy(dst, keep_begin, (size_t)keep_len); dst += keep_len;
+				if (!cut_left) memcpy(dst, "...", 3);
+			}
+		}
 
-		// First see if we need to truncate at all
-		ImVec2 full = ImGui::CalcTextSize(text, nullptr, false, wrap_width);
-		if (full.y <= max_height)
+		if (entry.truncated)
+			ImGui::TextUnformatted(entry.output.begin(), entry.output.end());
+		else
+			ImGui::TextUnformatted(text, text_end);
+
+		bool want_tooltip = (flags & (TextLimitedFlags_TooltipShowAll | TextLimitedFlags_TooltipShowCutoff)) != 0;
+
+		if (want_tooltip && ImGui::IsItemHovered(ImGuiHoveredFlags_DelayNormal))
+		{
+			// The hidden part is a slice of the source text, so nothing was stored for it
+			std::string tooltip_text;
+			if (entry.truncated && (flags & TextLimitedFlags_TooltipShowCutoff))
+			{
+				tooltip_text = (cut_left) ? std::string(text, text + entry.cut) + "..." : "..." + std::string(text + entry.cut, text_end);
+			}
+			else if (flags & TextLimitedFlags_TooltipShowAll)
+			{
+				tooltip_text = text;
+			}
+
+			ImGui::BeginTooltip();
+			const float minWidth = ImGui::GetFontSize() * MINIMUM_TOOLTIP_WIDTH_MULTIPLIER;
+			float tooltipWrapWidth = (avail > minWidth) ? avail : minWidth;
+			ImGui::PushTextWrapPos(tooltipWrapWidth);
+			ImGui::TextUnformatted(tooltip_text.c_str());
+			ImGui::PopTextWrapPos();
+			ImGui::EndTooltip();
+		}
+	}
+
+	// Fills out_x with the prefix sum of glyph advances of [text, text_end) (codepoints + 1 entries, the last one is the full width)
+	// and out_offsets with the byte offset of each codepoint boundary. Advances are the same ones CalcTextSize adds up.
+	static void TextPrefixAdvances(const char* text, const char* text_end, ImVector<float>& out_x, ImVector<int>& out_offsets)
+	{
+		ImGuiContext& g = *GImGui;
+		ImFontBaked* baked = ImGui::GetFontBaked();
+		const float scale = g.FontSize / baked->Size;
+
+		out_x.resize(0);
+		out_offsets.resize(0);
+		float x = 0.0f;
+		const char* s = text;
+		while (s < text_end)
+		{
+			out_x.push_back(x);
+			out_offsets.push_back((int)(s - text));
+			unsigned int c = (unsigned int)(unsigned char)*s;
+			if (c < 0x80)
+				s += 1;
+			else
+				s += ImTextCharFromUtf8(&c, s, text_end);
+			x += baked->GetCharAdvance((ImWchar)c) * scale;
+		}
+		out_x.push_back(x);
+		out_offsets.push_back((int)(text_end - text));
+	}
+
+	// Allocation-free core of EllipsizeMiddleFit: keeps [text, *out_head_end) + "..." + [*out_tail_begin, text_end).
+	// Returns false (and both outputs = text_end) if the whole text fits.
+	// Widths are measured once into a prefix sum, then both cut points are found by binary search.
+	// If separators is not empty (e.g. "/\\" for paths), cuts are moved onto component boundaries: the last component
+	// (file name) is kept whole when it fits, the tail starts on a separator and the head ends right after one,
+	// so "/home/user/projects/assets/file.png" becomes "/home/.../file.png" rather than "/home/us...ts/file.png".
+	static bool EllipsizeMiddleFitPos(const char* text, const char* text_end, float max_width,
+		const char** out_head_end, const char** out_tail_begin, const char* separators = "/\\")
+	{
+		*out_head_end = *out_tail_begin = text_end;
+
+		TextFormatsCache& cache = GetTextFormatsCache();
+		ImVector<float>& xs = cache.PrefixX;
+		ImVector<int>& ofs = cache.PrefixOffsets;
+		TextPrefixAdvances(text, text_end, xs, ofs);
+		const int n = xs.Size - 1; // codepoint count
+		const float total = xs[n];
+		if (n == 0 || (max_width > 0.0f && total <= max_width))
+			return false;
+
+		*out_head_end = text;
+		*out_tail_begin = text_end;
+		const float budget = max_width - ImGui::CalcTextSize("...").x;
+		if (budget <= 0.0f)
+			return true;
+
+		const bool use_separators = separators && separators[0];
+		auto is_sep = [&](int i) { const char c = text[ofs[i]]; return (unsigned char)c < 0x80 && strchr(separators, c) != nullptr; };
+		// Smallest b such that the tail [b, n) is at most w wide
+		auto tail_begin_for = [&](float w)
+		{
+			int lo = 0, hi = n;
+			while (lo < hi) { int mid = (lo + hi) / 2; if (total - xs[mid] <= w) hi = mid; else lo = mid + 1; }
+			return lo;
+		};
+		// Largest a such that the head [0, a) is at most w wide
+		auto head_end_for = [&](float w)
+		{
+			int lo = 0, hi = n;
+			while (lo < hi) { int mid = (lo + hi + 1) / 2; if (xs[mid] <= w) lo = mid; else hi = mid - 1; }
+			return lo;
+		};
+
+		// Tail first: by default it gets half of the budget
+		int b = tail_begin_for(budget * 0.5f);
+		if (use_separators)
+		{
+			int last_sep = -1;
+			for (int i = n - 1; i >= 0 && last_sep < 0; --i)
+				if (is_sep(i)) last_sep = i;
+
+			if (last_sep >= 0 && last_sep < b && total - xs[last_sep] <= budget)
+				b = last_sep; // keep the whole last component, even if it takes more than half
+			else
+				while (b <= last_sep && !is_sep(b)) b++; // shrink the tail to start on the next separator, if one is left
+		}
+
+		// Head gets whatever the tail left over, ending right after a separator when there is one
+		int a = ImMin(head_end_for(budget - (total - xs[b])), b);
+		if (use_separators)
+		{
+			int i = a;
+			while (i > 0 && !is_sep(i - 1)) i--;
+			if (i > 0) a = i;
+		}
+
+		*out_head_end = text + ofs[a];
+		*out_tail_begin = text + ofs[b];
+		return true;
+	}
+
+	static std::string EllipsizeMiddleFit(const char* text, float max_width, std::string* out_cutoff = nullptr, const char* separators = "/\\")
+	{
+		if (out_cutoff) out_cutoff->clear();
+		if (!text) return {};
+
+		const char* text_end = text + strlen(text);
+		const char* head_end;
+		const char* tail_begin;
+		if (!EllipsizeMiddleFitPos(text, text_end, max_width, &head_end, &tail_begin, separators))
 			return text;
 
-		// Build a table of UTF-8 codepoint boundaries so we never split a codepoint
-		std::vector<const char*> cps;
-		cps.reserve(strlen(text) + 1);
+		if (out_cutoff)
+			*out_cutoff = std::string(head_end, tail_begin); // hidden middle
 
-		const char* p = text;
-		while (*p)
+		return std::string(text, head_end) + "..." + std::string(tail_begin, text_end);
+	}
+
+	// Draw text that is limited to a maximum width by replacing its middle with "...", e.g. for file paths.
+	// separators: characters the cuts prefer to land on, pass nullptr or "" for a plain middle cut.
+	inline void TextLimitedMiddle(
+		const char* text,
+		float max_width = -1.0f,
+		float padding_px = 0.0f,
+		TextLimitedFlags flags = TextLimitedFlags_TooltipShowAll,
+		const char* separators = "/\\")
+	{
+		float avail = (max_width >= 0.0f ? max_width : ImGui::GetContentRegionAvail().x) - padding_px;
+		std::string coff;
+		if (avail < 0.0f) avail = 0.0f;
+		std::string s = EllipsizeMiddleFit(text, avail, &coff, separators);
+
+		const bool truncated = !coff.empty();
+		ImGui::TextUnformatted(s.c_str());
+
+		bool want_tooltip = (flags & (TextLimitedFlags_TooltipShowAll | TextLimitedFlags_TooltipShowCutoff)) != 0;
+
+		if (want_tooltip && ImGui::IsItemHovered(ImGuiHoveredFlags_DelayNormal))
 		{
-			cps.push_back(p);
-			unsigned char c = (unsigned char)*p++;
-			if (c & 0x80)        // multibyte
-				while ((*p & 0xC0) == 0x80) // continuation bytes
-					p++;
+			std::string tooltip_text;
+			if (truncated && (flags & TextLimitedFlags_TooltipShowCutoff))
+			{
+				tooltip_text = "..." + coff + "...";
+			}
+			else if (flags & TextLimitedFlags_TooltipShowAll)
+			{
+				tooltip_text = text;
+			}
+
+			ImGui::BeginTooltip();
+			const float minWidth = ImGui::GetFontSize() * MINIMUM_TOOLTIP_WIDTH_MULTIPLIER;
+			float tooltipWrapWidth = (avail > minWidth) ? avail : minWidth;
+			ImGui::PushTextWrapPos(tooltipWrapWidth);
+			ImGui::TextUnformatted(tooltip_text.c_str());
+			ImGui::PopTextWrapPos();
+			ImGui::EndTooltip();
 		}
-		const char* text_end = p;
-		cps.push_back(text_end); // sentinel end
+	}
+
+	// Same as TextLimitedMiddle, but the cut points are cached per ID. While the text, width and font are unchanged a frame
+	// only hashes the text bytes and draws the stored result: no glyph is measured and nothing is allocated.
+	// Meant for path columns in large tables (e.g. with ImGuiListClipper).
+	inline void TextLimitedMiddleCached(
+		const char* itemID, // must be stable and unique per text instance (e.g. PushID(row) + "path")
+		const char* text,
+		float max_width = -1.0f,
+		float padding_px = 0.0f,
+		TextLimitedFlags flags = TextLimitedFlags_TooltipShowAll,
+		const char* separators = "/\\")
+	{
+		ImGuiWindow* window = ImGui::GetCurrentWindow();
+		if (window->SkipItems)
+			return;
+
+		if (!text)
+			text = "";
+		const char* text_end = text + strlen(text);
 
-		const int cp_count = (int)cps.size() - 1; // last index with an actual codepoint
-		if (cp_count <= 0)
-			return dots;
+		float avail = (max_width >= 0.0f ? max_width : ImGui::GetContentRegionAvail().x) - padding_px;
+		if (avail < 0.0f) avail = 0.0f;
 
-		// Binary search the largest prefix that still fits when we append "..."
-		int lo = 0;
-		int hi = cp_count; // we know full text doesn't fit, but it's ok for the search
+		ImGuiContext& g = *GImGui;
+		ImGuiID id = window->GetID(itemID);
+		bool created = false;
+		TextMiddleCacheEntry& entry = GetTextFormatsCache().Middle.Get(id, &created);
 
-		while (lo < hi)
+		const ImU64 hash = TextHash64(text, text_end);
+		bool need_recalc =
+			created ||
+			entry.text_hash != hash ||
+			entry.separators != separators ||
+			entry.font != g.Font ||
+			entry.font_size != g.FontSize ||
+			fabsf(entry.avail - avail) > 0.5f;
+		if (need_recalc)
 		{
-			int mid = (lo + hi + 1) / 2; // bias upward
+			entry.text_hash = hash;
+			entry.separators = separators;
+			entry.font = g.Font;
+			entry.font_size = g.FontSize;
+			entry.avail = avail;
+
+			const char* head_end;
+			const char* tail_begin;
+			entry.truncated = EllipsizeMiddleFitPos(text, text_end, avail, &head_end, &tail_begin, separators);
+			entry.head_end = (int)(head_end - text);
+			entry.tail_begin = (int)(tail_begin - text);
+			entry.output.resize(0);
+			if (entry.truncated)
+			{
+				const int head_len = entry.head_end;
+				const int tail_len = (int)(text_end - tail_begin);
+				entry.output.resize(head_len + 3 + tail_len);
+				char* dst = entry.output.Data;
+				memcpy(dst, text, (size_t)head_len); dst += head_len;
+				memcpy(dst, "...", 3); dst += 3;
+				memcpy(dst, tail_begin, (size_t)tail_len);
+			}
+		}
 
-			std::string tmp(text, cps[mid]);
-			tmp += dots;
+		if (entry.truncated)
+			ImGui::TextUnformatted(entry.output.begin(), entry.output.end());
+		else
+			ImGui::TextUnformatted(text, text_end);
+
+		bool want_tooltip = (flags & (TextLimitedFlags_TooltipShowAll | TextLimitedFlags_TooltipShowCutoff)) != 0;
 
-			ImVec2 sz = ImGui::CalcTextSize(tmp.c_str(), nullptr, false, wrap_width);
-			if (sz.y <= max_height)
-				lo = mid;   // this fits, try to take more
+		if (want_tooltip && ImGui::IsItemHovered(ImGuiHoveredFlags_DelayNormal))
+		{
+			// The hidden middle is a slice of the source text, so nothing was stored for it
+			std::string tooltip_text;
+			if (entry.truncated && (flags & TextLimitedFlags_TooltipShowCutoff))
+			{
+				tooltip_text = "..." + std::string(text + entry.head_end, text + entry.tail_begin) + "...";
+			}
+			else if (flags & TextLimitedFlags_TooltipShowAll)
+			{
+				tooltip_text = text;
+			}
+
+			ImGui::BeginTooltip();
+			const float minWidth = ImGui::GetFontSize() * MINIMUM_TOOLTIP_WIDTH_MULTIPLIER;
+			float tooltipWrapWidth = (avail > minWidth) ? avail : minWidth;
+			ImGui::PushTextWrapPos(tooltipWrapWidth);
+			ImGui::TextUnformatted(tooltip_text.c_str());
+			ImGui::PopTextWrapPos();
+			ImGui::EndTooltip();
+		}
+	}
+
+	// Allocation-free core of EllipsizeMultilineFit: returns the end of the prefix to keep before "...",
+	// or text_end if the whole text fits. The kept text is [text, result) and the hidden tail is [result, text_end).
+	// Single forward pass: lines are broken with the same word-wrap rule as CalcTextSize, and only the last
+	// allowed line is measured per codepoint to make room for the ellipsis.
+	static const char* EllipsizeMultilineFitPos(const char* text, const char* text_end, float wrap_width, float max_height)
+	{
+		if (wrap_width <= 0.0f || max_height <= 0.0f)
+			return text;
+
+		ImGuiContext& g = *GImGui;
+		ImFont* font = g.Font;
+		const float font_size = g.FontSize;
+		const int max_lines = (int)ImFloor(max_height / font_size + 1e-4f); // CalcTextSize uses FontSize per line, without spacing
+		if (max_lines <= 0)
+			return text;
+
+		const char* s = text;
+		for (int line = 0; s < text_end; ++line)
+		{
+			// Hard line breaks end a line regardless of wrapping
+			const char* hard_eol = (const char*)memchr(s, '\n', (size_t)(text_end - s));
+			if (!hard_eol)
+				hard_eol = text_end;
+
+			const char* eol = font->CalcWordWrapPosition(font_size, s, hard_eol, wrap_width);
+			if (eol <= s && s < hard_eol)
+			{
+				// wrap width too small to fit anything, force one codepoint per line like ImGui does
+				unsigned int c;
+				eol = s + ImTextCharFromUtf8(&c, s, hard_eol);
+			}
+
+			// Start of the following line: after the newline, or after the blanks a wrap swallows
+			const char* next = eol;
+			if (eol >= hard_eol)
+				next = (hard_eol < text_end) ? hard_eol + 1 : text_end;
 			else
-				hi = mid - 1; // too tall, take less
+			{
+				while (next < hard_eol && ImCharIsBlankA(*next))
+					next++;
+				if (next == hard_eol && hard_eol < text_end)
+					next++; // a wrap right before a newline consumes it too, like ImGui's layout
+			}
+
+			if (next >= text_end)
+				return text_end; // everything fits
+
+			if (line < max_lines - 1)
+			{
+				s = next;
+				continue;
+			}
+
+			// Last allowed line and there is more text: keep what fits on this line together with "..."
+			const float target_w = wrap_width - font->CalcTextSizeA(font_size, FLT_MAX, 0.0f, "...").x;
+			const char* last_good = s;
+			float w = 0.0f;
+			for (const char* p = s; p < hard_eol; )
+			{
+				const char* prev = p;
+				unsigned int c;
+				p += ImTextCharFromUtf8(&c, p, hard_eol);
+				w += font->CalcTextSizeA(font_size, FLT_MAX, 0.0f, prev, p).x;
+				if (w > target_w)
+					break;
+				last_good = p;
+			}
+			return last_good;
 		}
+		return text_end;
+	}
+
+	static std::string EllipsizeMultilineFit(const char* text, float wrap_width, float max_height, std::string* out_cutoff = nullptr)
+	{
+		if (out_cutoff) out_cutoff->clear();
+		if (!text)
+			return {};
 
-		if (lo <= 0)
-			return dots; // not even one codepoint + "..." fits nicely
+		const char* text_end = text + strlen(text);
+		const char* cut = EllipsizeMultilineFitPos(text, text_end, wrap_width, max_height);
+		if (cut == text_end)
+			return text;
 
-		if (out_cutoff && cps[lo] < text_end)
-			*out_cutoff = std::string(cps[lo], text_end); // hidden tail
+		if (out_cutoff)
+			*out_cutoff = std::string(cut, text_end); // hidden tail
 
-		std::string out(text, cps[lo]);
-		out += dots;
+		std::string out(text, cut);
+		out += "...";
 		return out;
 	}
 	
@@ -261,48 +693,51 @@ namespace ImGui
 		}
 
 		// ---------- CACHING LAYER ----------
-		// one cache map per frame
-		static std::unordered_map<ImGuiID, TextWrappedLimitedCacheEntry> s_cache;
-		int frame = ImGui::GetFrameCount();
-		// Use a widget ID as cache key.
+		// Per-context LRU keyed by widget ID, validated against a hash of the text
+		ImGuiContext& g = *GImGui;
+		const char* text_end = text + strlen(text);
 		ImGuiID id = window->GetID(itemID);
-		TextWrappedLimitedCacheEntry& entry = s_cache[id];
-		entry.last_frame_used = frame;
+		bool created = false;
+		TextWrappedLimitedCacheEntry& entry = GetTextFormatsCache().WrappedLimited.Get(id, &created);
+		const ImU64 hash = TextHash64(text, text_end);
 		bool need_recalc =
-			entry.input != text ||
+			created ||
+			entry.text_hash != hash ||
+			entry.font != g.Font ||
+			entry.font_size != g.FontSize ||
 			fabsf(entry.wrap_width - avail_w) > 0.5f ||
 			fabsf(entry.max_height - max_height_px) > 0.5f;
-		std::string coff;
 		if (need_recalc)
 		{
-			entry.input = text;
+			entry.text_hash = hash;
+			entry.font = g.Font;
+			entry.font_size = g.FontSize;
 			entry.wrap_width = avail_w;
 			entry.max_height = max_height_px;
-			entry.output = EllipsizeMultilineFit(text, avail_w, max_height_px, &coff);
-			entry.cutoff = coff;
-		}
-		else
-			coff = entry.cutoff;
 
-		if (s_cache.size() > 128) // arbitrary max cache size for cleanup
-		{
-			for (auto it = s_cache.begin(); it != s_cache.end(); )
+			const char* cut = EllipsizeMultilineFitPos(text, text_end, avail_w, max_height_px);
+			entry.truncated = (cut != text_end);
+			entry.cut = (int)(cut - text);
+			entry.output.resize(0);
+			if (entry.truncated)
 			{
-				if (it->second.last_frame_used < frame - 300) // not used for ~300 frames
-					it = s_cache.erase(it);
-				else
-					++it;
+				const int keep_len = entry.cut;
+				entry.output.resize(keep_len + 3);
+				memcpy(entry.output.Data, text, (size_t)keep_len);
+				memcpy(entry.output.Data + keep_len, "...", 3);
 			}
 		}
 
-		const std::string& s = entry.output;
-		const bool truncated = !coff.empty();
+		const bool truncated = entry.truncated;
 		// ---------- END CACHING LAYER ----------
 
 		// Render it with wrapping
 		float wrap_pos = ImGui::GetCursorPos().x + avail_w; // window-local
 		ImGui::PushTextWrapPos(wrap_pos);
-		ImGui::TextUnformatted(s.c_str());
+		if (truncated)
+			ImGui::TextUnformatted(entry.output.begin(), entry.output.end());
+		else
+			ImGui::TextUnformatted(text, text_end);
 		ImGui::PopTextWrapPos();
 
 		bool want_tooltip = (flags & (TextLimitedFlags_TooltipShowAll | TextLimitedFlags_TooltipShowCutoff)) != 0;
@@ -313,7 +748,7 @@ namespace ImGui
 			std::string tooltip_text;
 			if (truncated && (flags & TextLimitedFlags_TooltipShowCutoff))
 			{
-				tooltip_text = "..." + coff;
+				tooltip_text = "..." + std::string(text + entry.cut, text_end);
 			}
 			else if (flags & TextLimitedFlags_TooltipShowAll)
 			{
@@ -366,5 +801,263 @@ namespace ImGui
 		va_end(args);
 	}
 
+	// ---------- NUMBER FORMATTING ----------
+	// Allocation-free formatters. Each one writes into buf (buf_size bytes, always null-terminated) and returns it.
+	// Passing buf = nullptr writes into ImGui's shared temp buffer instead, which stays valid until the next ImGui call that formats text.
+
+	// Separators used by the number formatters. Captured once from the system locale on first use,
+	// and can be overridden with SetNumberFormatLocale (e.g. to follow an in-app language setting).
+	struct NumberFormatLocale
+	{
+		char group_sep[8] = ",";   // UTF-8, empty = no separator
+		char decimal_sep[8] = "."; // UTF-8
+		char grouping[8] = "\3";   // std::numpunct::grouping() style: group sizes from the right, the last one repeats, empty = no grouping
+	};
+
+	inline NumberFormatLocale& NumberFormatLocaleStorage()
+	{
+		static NumberFormatLocale s_locale = []()
+		{
+			NumberFormatLocale loc;
+			try
+			{
+				const std::numpunct<char>& np = std::use_facet<std::numpunct<char>>(std::locale("")); // uses system locale (adds commas in most regions)
+				const char sep = np.thousands_sep();
+				const char dec = np.decimal_point();
+				// numpunct<char> can't hold multi-byte separators (e.g. narrow no-break space), fall back to plain ASCII ones
+				loc.group_sep[0] = ((unsigned char)sep < 0x80) ? sep : ' ';
+				loc.group_sep[1] = 0;
+				loc.decimal_sep[0] = ((unsigned char)dec < 0x80 && dec != 0) ? dec : '.';
+				loc.decimal_sep[1] = 0;
+				ImStrncpy(loc.grouping, np.grouping().c_str(), IM_ARRAYSIZE(loc.grouping));
+			}
+			catch (...) {} // unknown system locale, keep the defaults
+			return loc;
+		}();
+		return s_locale;
+	}
+	inline const NumberFormatLocale& GetNumberFormatLocale() { return NumberFormatLocaleStorage(); }
+	inline void SetNumberFormatLocale(const NumberFormatLocale& loc) { NumberFormatLocaleStorage() = loc; }
+
+	// Writes [digits, digits + count) right-aligned so that it ends at 'end', inserting group separators. Returns the new start.
+	static char* NumberFmt_WriteGroupedDigits(char* end, const char* digits, int count, const NumberFormatLocale& loc)
+	{
+		char* p = end;
+		const int sep_len = (int)strlen(loc.group_sep);
+		int gi = 0;
+		int group = loc.grouping[0];
+		int in_group = 0;
+		for (int i = count - 1; i >= 0; --i)
+		{
+			if (group > 0 && group != CHAR_MAX && in_group == group)
+			{
+				p -= sep_len;
+				memcpy(p, loc.group_sep, (size_t)sep_len);
+				in_group = 0;
+				if (loc.grouping[gi + 1] != 0)
+					group = loc.grouping[++gi];
+			}
+			*--p = digits[i];
+			in_group++;
+		}
+		return p;
+	}
+
+	// Length of count digits once NumberFmt_WriteGroupedDigits has inserted the group separators
+	static int NumberFmt_GroupedLength(int count, const NumberFormatLocale& loc)
+	{
+		const int sep_len = (int)strlen(loc.group_sep);
+		int len = count;
+		int gi = 0;
+		int group = loc.grouping[0];
+		for (int remaining = count; group > 0 && group != CHAR_MAX && remaining > group; )
+		{
+			remaining -= group;
+			len += sep_len;
+			if (loc.grouping[gi + 1] != 0)
+				group = loc.grouping[++gi];
+		}
+		return len;
+	}
+
+	// Rewrites a "C"-style printf number (e.g. "-12345.678" or "1.5e+03") with the locale separators.
+	static int NumberFmt_Localize(char* out, int out_size, const char* raw, bool group)
+	{
+		const NumberFormatLocale& loc = GetNumberFormatLocale();
+		const char* p = raw;
+		const bool negative = (*p == '-');
+		if (negative) p++;
+		const char* int_begin = p;
+		while (*p >= '0' && *p <= '9') p++;
+		const int int_len = (int)(p - int_begin);
+		if (int_len == 0) // inf/nan
+			return ImFormatString(out, (size_t)out_size, "%s", raw);
+
+		// Whatever printf used as decimal point (depends on the C locale), followed by fraction/exponent
+		const char* frac = p;
+		while (*frac && !(*frac >= '0' && *frac <= '9') && *frac != 'e' && *frac != 'E') frac++;
+		const bool has_point = (frac != p);
+
+		// Integer part, grouped right to left straight into out. Falls back to ungrouped digits when the grouped form doesn't fit.
+		const int int_out_len = group ? NumberFmt_GroupedLength(int_len, loc) : int_len;
+		const int tail_len = (has_point ? (int)strlen(loc.decimal_sep) : 0) + (int)strlen(frac);
+		if ((negative ? 1 : 0) + int_out_len + tail_len >= out_size)
+			return ImFormatString(out, (size_t)out_size, "%s%.*s%s%s", negative ? "-" : "", int_len, int_begin, has_point ? loc.decimal_sep : "", frac);
 
+		char* o = out;
+		if (negative) *o++ = '-';
+		char* int_end = o + int_out_len;
+		if (int_out_len != int_len)
+			NumberFmt_WriteGroupedDigits(int_end, int_begin, int_len, loc);
+		else
+			memcpy(o, int_begin, (size_t)int_len);
+		return (int)(int_end - out) + ImFormatString(int_end, (size_t)(out_size - (int_end - out)), "%s%s", has_point ? loc.decimal_sep : "", frac);
+	}
+
+	static const char* NumberFmt_Emit(char* buf, int buf_size, const char* s)
+	{
+		if (buf == nullptr)
+		{
+			ImGuiContext& g = *GImGui;
+			buf = g.TempBuffer.Data;
+			buf_size = g.TempBuffer.Size;
+		}
+		ImFormatString(buf, (size_t)buf_size, "%s", s);
+		return buf;
+	}
+
+	// 1234567 -> "1,234,567"
+	inline const char* FormatIntGrouped(char* buf, int buf_size, long long value)
+	{
+		char digits[24];
+		unsigned long long v = value < 0 ? 0ull - (unsigned long long)value : (unsigned long long)value;
+		int n = 0;
+		do { digits[IM_ARRAYSIZE(digits) - 1 - n++] = (char)('0' + v % 10); v /= 10; } while (v);
+
+		char tmp[24 * 8 + 2];
+		char* end = tmp + IM_ARRAYSIZE(tmp) - 1;
+		*end = 0;
+		char* p = NumberFmt_WriteGroupedDigits(end, digits + IM_ARRAYSIZE(digits) - n, n, GetNumberFormatLocale());
+		if (value < 0) *--p = '-';
+		return NumberFmt_Emit(buf, buf_size, p);
+	}
+
+	// 1234567.891 -> "1,234,567.89"
+	inline const char* FormatFloatGrouped(char* buf, int buf_size, double value, int decimals = 2)
+	{
+		char raw[512];
+		ImFormatString(raw, sizeof(raw), "%.*f", ImClamp(decimals, 0, 20), value);
+		char tmp[512];
+		NumberFmt_Localize(tmp, IM_ARRAYSIZE(tmp), raw, true);
+		return NumberFmt_Emit(buf, buf_size, tmp);
+	}
+
+	// 1234567.891 -> "1.23e+06"
+	inline const char* FormatFloatScientific(char* buf, int buf_size, double value, int decimals = 2)
+	{
+		char raw[64];
+		ImFormatString(raw, sizeof(raw), "%.*e", ImClamp(decimals, 0, 20), value);
+		char tmp[64];
+		NumberFmt_Localize(tmp, IM_ARRAYSIZE(tmp), raw, false);
+		return NumberFmt_Emit(buf, buf_size, tmp);
+	}
+
+	// 1536 -> "1.5 KiB" (or "1.5 kB" with si_units). Values below one unit are printed as grouped bytes, e.g. "1,000 B".
+	inline const char* FormatBytes(char* buf, int buf_size, ImU64 bytes, int decimals = 1, bool si_units = false)
+	{
+		static const char* const iec[] = { "B", "KiB", "MiB", "GiB", "TiB", "PiB", "EiB" };
+		static const char* const si[] = { "B", "kB", "MB", "GB", "TB", "PB", "EB" };
+		const char* const* units = si_units ? si : iec;
+		const double base = si_units ? 1000.0 : 1024.0;
+
+		char num[64];
+		char tmp[80];
+		if ((double)bytes < base)
+		{
+			FormatIntGrouped(num, IM_ARRAYSIZE(num), (long long)bytes);
+			ImFormatString(tmp, sizeof(tmp), "%s B", num);
+			return NumberFmt_Emit(buf, buf_size, tmp);
+		}
+
+		double v = (double)bytes;
+		int u = 0;
+		while (v >= base && u < 6) { v /= base; u++; }
+		// Avoid "1024.0 KiB" when rounding reaches the next unit
+		const double scale = pow(10.0, ImClamp(decimals, 0, 6));
+		if (floor(v * scale + 0.5) / scale >= base && u < 6) { v /= base; u++; }
+
+		FormatFloatGrouped(num, IM_ARRAYSIZE(num), v, decimals);
+		ImFormatString(tmp, sizeof(tmp), "%s %s", num, units[u]);
+		return NumberFmt_Emit(buf, buf_size, tmp);
+	}
+
+	// Picks the unit from the magnitude: "850 ns", "12.5 ms", "3.2 s", "4m 05s", "2h 03m 07s", "3d 04h 10m"; NaN gives "--", infinities "inf"
+	inline const char* FormatDuration(char* buf, int buf_size, double seconds, int decimals = 1)
+	{
+		const char* sign = seconds < 0.0 ? "-" : "";
+		const double s = fabs(seconds);
+		char num[64];
+		char tmp[96];
+		if (std::isnan(seconds))
+			return NumberFmt_Emit(buf, buf_size, "--");
+		if (std::isinf(seconds))
+		{
+			ImFormatString(tmp, sizeof(tmp), "%sinf", sign);
+			return NumberFmt_Emit(buf, buf_size, tmp);
+		}
+		if (s < 60.0)
+		{
+			const char* unit = "s";
+			double v = s;
+			if (s < 1e-6)      { v = s * 1e9; unit = "ns"; }
+			else if (s < 1e-3) { v = s * 1e6; unit = "\xC2\xB5s"; } // micro sign, part of ImGui's default glyph range
+			else if (s < 1.0)  { v = s * 1e3; unit = "ms"; }
+			FormatFloatGrouped(num, IM_ARRAYSIZE(num), v, (unit[0] == 'n') ? 0 : decimals);
+			ImFormatString(tmp, sizeof(tmp), "%s%s %s", sign, num, unit);
+			return NumberFmt_Emit(buf, buf_size, tmp);
+		}
+
+		if (s >= 18446744073709551616.0) // 2^64, past what the integer split below can hold: whole days only
+		{
+			FormatFloatGrouped(num, IM_ARRAYSIZE(num), floor(s / 86400.0), 0);
+			ImFormatString(tmp, sizeof(tmp), "%s%sd", sign, num);
+			return NumberFmt_Emit(buf, buf_size, tmp);
+		}
+		const unsigned long long total = (unsigned long long)s;
+		const unsigned long long days = total / 86400, hours = (total / 3600) % 24, minutes = (total / 60) % 60, secs = total % 60;
+		if (days > 0)
+			ImFormatString(tmp, sizeof(tmp), "%s%llud %02lluh %02llum", sign, days, hours, minutes);
+		else if (hours > 0)
+			ImFormatString(tmp, sizeof(tmp), "%s%lluh %02llum %02llus", sign, hours, minutes, secs);
+		else
+			ImFormatString(tmp, sizeof(tmp), "%s%llum %02llus", sign, minutes, secs);
+		return NumberFmt_Emit(buf, buf_size, tmp);
+	}
+
+	// SI prefixed value with a unit, e.g. rates: FormatSI(buf, n, 1.5e6, "B/s") -> "1.50 MB/s", FormatSI(buf, n, 0.0042, "s") -> "4.20 ms"
+	inline const char* FormatSI(char* buf, int buf_size, double value, const char* unit = "", int decimals = 2)
+	{
+		static const char* const prefixes[] = { "n", "\xC2\xB5", "m", "", "k", "M", "G", "T", "P", "E" };
+		const int unit_index = 3;
+		int p = unit_index;
+		double v = fabs(value);
+		if (v != 0.0)
+		{
+			while (v >= 1000.0 && p < IM_ARRAYSIZE(prefixes) - 1) { v /= 1000.0; p++; }
+			while (v < 1.0 && p > 0) { v *= 1000.0; p--; }
+			const double scale = pow(10.0, ImClamp(decimals, 0, 6));
+			if (floor(v * scale + 0.5) / scale >= 1000.0 && p < IM_ARRAYSIZE(prefixes) - 1) { v /= 1000.0; p++; }
+		}
+		char num[64];
+		char tmp[96];
+		FormatFloatGrouped(num, IM_ARRAYSIZE(num), value < 0.0 ? -v : v, decimals);
+		ImFormatString(tmp, sizeof(tmp), "%s %s%s", num, prefixes[p], unit ? unit : "");
+		return NumberFmt_Emit(buf, buf_size, tmp);
+	}
+
+	inline void TextIntFormatted(long long value)
+	{
+		char buf[64];
+		ImGui::TextUnformatted(FormatIntGrouped(buf, IM_ARRAYSIZE(buf), value));
+	}
 }
\ No newline at end of file
@@ -0,0 +1,270 @@
+#pragma once
+#include <imgui.h>
+#include <imgui_internal.h>
+#include <stdlib.h>
+#include "imguiTween.h"
+
+// Keyframe timelines: tracks of values animated by clips ("go to this value over this duration, with this easing")
+// that are laid out in sequenced and parallel groups, then compiled into one flat array of segments.
+//
+//   ImGui::Timeline tl;
+//   int alpha = tl.AddTrack(0.0f), y = tl.AddTrack(20.0f);
+//   tl.BeginParallel();
+//       tl.To(alpha, 1.0f, 0.25f);
+//       tl.To(y, 0.0f, 0.40f, Easing::easeOutCubic);
+//   tl.End();
+//   tl.Wait(0.1f);
+//   tl.To(y, -8.0f, 0.2f);          // sequenced after the group
+//   tl.Compile();
+//   ...
+//   tl.EvaluateAll(t, values);      // every track at time t, values[track]
+namespace ImGui
+{
+	typedef float (*TimelineEaseFn)(float); // nullptr = linear
+
+	struct Timeline
+	{
+		// ---- Authoring ----
+
+		void Clear()
+		{
+			TrackInitial.resize(0);
+			Clips.resize(0);
+			Groups.resize(0);
+			RootEnd = 0.0f;
+			Compiled = false;
+		}
+
+		// Adds a track starting at initial, returns its index. Float tracks use the x component.
+		int AddTrack(const ImVec4& initial)
+		{
+			TrackInitial.push_back(initial);
+			Compiled = false;
+			return TrackInitial.Size - 1;
+		}
+		int AddTrack(float initial) { return AddTrack(ImVec4(initial, 0.0f, 0.0f, 0.0f)); }
+
+		// Clips inside a sequence play one after the other; clips inside a parallel group all start with the group.
+		// Outside of any group clips are sequenced. Groups nest and are closed with End().
+		void BeginSequence() { PushGroup(false); }
+		void BeginParallel() { PushGroup(true); }
+		void End()
+		{
+			IM_ASSERT(Groups.Size > 0 && "Timeline::End() without a matching Begin");
+			const Group child = Groups.back();
+			Groups.pop_back();
+			Advance(child.End);
+		}
+
+		// Animates track from its value at the clip start to value over duration seconds
+		void To(int track, const ImVec4& value, float duration, TimelineEaseFn ease = nullptr)
+		{
+			IM_ASSERT(track >= 0 && track < TrackInitial.Size);
+			const float start = ClipStart();
+			Clip clip;
+			clip.Track = track;
+			clip.Order = Clips.Size;
+			clip.Start = start;
+			clip.Duration = ImMax(duration, 0.0f);
+			clip.Value = value;
+			clip.Ease = ease;
+			Clips.push_back(clip);
+			Advance(start + clip.Duration);
+			Compiled = false;
+		}
+		void To(int track, float value, float duration, TimelineEaseFn ease = nullptr) { To(track, ImVec4(value, 0.0f, 0.0f, 0.0f), duration, ease); }
+
+		// Leaves a gap of duration seconds (in a parallel group: makes the group last at least that long)
+		void Wait(float duration)
+		{
+			const float start = ClipStart();
+			Advance(start + ImMax(duration, 0.0f));
+		}
+
+		// Turns the clips into the flat segment array. Must be called after authoring, before evaluating.
+		// Clips of a track are ordered by start time; a clip starting while the previous one still runs takes over
+		// from the value reached at that moment.
+		void Compile()
+		{
+			IM_ASSERT(Groups.Size == 0 && "Timeline::Compile() with a group still open");
+			const int track_count = TrackInitial.Size;
+			Sorted = Clips;
+			if (Sorted.Size > 1)
+				qsort(Sorted.Data, (size_t)Sorted.Size, sizeof(Clip), CompareClips);
+
+			TrackFirst.resize(track_count);
+			TrackCount.resize(track_count);
+			TrackCursor.resize(track_count);
+			SegStart.resize(Sorted.Size);
+			SegInvDuration.resize(Sorted.Size);
+			SegEase.resize(Sorted.Size);
+			SegFrom.resize(Sorted.Size);
+			SegTo.resize(Sorted.Size);
+			for (int track = 0; track < track_count; ++track)
+				TrackFirst[track] = TrackCount[track] = TrackCursor[track] = 0;
+
+			Duration = 0.0f;
+			for (int n = 0; n < Sorted.Size; ++n)
+			{
+				const Clip& clip = Sorted[n];
+				const int track = clip.Track;
+				if (TrackCount[track] == 0)
+					TrackFirst[track] = n;
+				const ImVec4 from = TrackCount[track] == 0 ? TrackInitial[track] : EvalSegment(n - 1, clip.Start);
+				SegStart[n] = clip.Start;
+				SegInvDuration[n] = 1.0f / ImMax(clip.Duration, 1e-6f);
+				SegEase[n] = clip.Ease;
+				SegFrom[n] = from;
+				SegTo[n] = clip.Value;
+				TrackCount[track]++;
+				Duration = ImMax(Duration, clip.Start + clip.Duration);
+			}
+			Duration = ImMax(Duration, RootEnd);
+			Compiled = true;
+		}
+
+		// ---- Playback ----
+
+		float GetDuration() const { return Duration; }
+		int   GetTrackCount() const { return TrackInitial.Size; }
+
+		// Value of track at time t (seconds from the timeline start; clamped to the first and last keys)
+		ImVec4 Evaluate(int track, float t)
+		{
+			IM_ASSERT(Compiled && "Timeline::Compile() must be called after authoring");
+			if (TrackCount[track] == 0)
+				return TrackInitial[track];
+			return EvalSegment(FindSegment(track, t), t);
+		}
+
+		// Every track at time t: out[track], GetTrackCount() values
+		void EvaluateAll(float t, ImVec4* out)
+		{
+			IM_ASSERT(Compiled && "Timeline::Compile() must be called after authoring");
+			for (int track = 0; track < TrackInitial.Size; ++track)
+				out[track] = TrackCount[track] == 0 ? TrackInitial[track] : EvalSegment(FindSegment(track, t), t);
+		}
+
+	private:
+		struct Clip
+		{
+			int            Track;
+			int            Order;      // authoring order, breaks ties between clips starting together
+			float          Start;
+			float          Duration;
+			ImVec4         Value;
+			TimelineEaseFn Ease;
+		};
+		struct Group
+		{
+			bool  Parallel;
+			float Start, Cursor, End;
+		};
+
+		// Authoring
+		ImVector<ImVec4> TrackInitial;
+		ImVector<Clip>   Clips;
+		ImVector<Group>  Groups;
+		float            RootEnd = 0.0f;   // end of the implicit top level sequence
+		bool             Compiled = false;
+
+		// Compiled: the segments of track are [TrackFirst, TrackFirst + TrackCount), ordered by start time
+		ImVector<Clip>           Sorted;
+		ImVector<int>            TrackFirst, TrackCount;
+		ImVector<int>            TrackCursor;   // last segment found per track (relative), playback mostly moves forward
+		ImVector<float>          SegStart, SegInvDuration;
+		ImVector<TimelineEaseFn> SegEase;
+		ImVector<ImVec4>         SegFrom, SegTo;
+		float                    Duration = 0.0f;
+
+		static int CompareClips(const void* lhs, const void* rhs)
+		{
+			const Clip& a = *(const Clip*)lhs;
+			const Clip& b = *(const Clip*)rhs;
+			if (a.Track != b.Track) return a.Track < b.Track ? -1 : 1;
+			if (a.Start != b.Start) return a.Start < b.Start ? -1 : 1;
+			return a.Order < b.Order ? -1 : (a.Order > b.Order ? 1 : 0);
+		}
+
+		void PushGroup(bool parallel)
+		{
+			Group group;
+			group.Parallel = parallel;
+			group.Start = group.Cursor = group.End = ClipStart();
+			Groups.push_back(group);
+		}
+
+		float ClipStart() const
+		{
+			if (Groups.Size == 0)
+				return RootEnd;
+			const Group& group = Groups.back();
+			return group.Parallel ? group.Start : group.Cursor;
+		}
+
+		// Something ending at end was added to the innermost group
+		void Advance(float end)
+		{
+			if (Groups.Size == 0)
+			{
+				RootEnd = ImMax(RootEnd, end);
+				return;
+			}
+			Group& group = Groups.back();
+			if (!group.Parallel)
+				group.Cursor = end;
+			group.End = ImMax(group.End, end);
+		}
+
+		// Last segment of track starting at or before t (the first one if t is before all of them).
+		// Checks the previous result and the one after it first, then falls back to a binary search.
+		int FindSegment(int track, float t)
+		{
+			const int first = TrackFirst[track];
+			const int count = TrackCount[track];
+			const float* start = SegStart.Data + first;
+			int c = TrackCursor[track];
+			if (start[c] <= t || c == 0)
+			{
+				if (c + 1 >= count || t < start[c + 1])
+					return first + c;
+				if (c + 2 >= count || t < start[c + 2])
+				{
+					TrackCursor[track] = c + 1;
+					return first + c + 1;
+				}
+			}
+			int lo = 0, hi = count; // first segment starting after t
+			while (lo < hi)
+			{
+				const int mid = (lo + hi) >> 1;
+				if (start[mid] <= t) lo = mid + 1; else hi = mid;
+			}
+			c = ImMax(lo - 1, 0);
+			TrackCursor[track] = c;
+			return first + c;
+		}
+
+		ImVec4 EvalSegment(int n, float t) const
+		{
+			float u = ImSaturate((t - SegStart[n]) * SegInvDuration[n]);
+			if (SegEase[n])
+				u = SegEase[n](u);
+			const ImVec4& a = SegFrom[n];
+			const ImVec4& b = SegTo[n];
+			return ImVec4(a.x + (b.x - a.x) * u, a.y + (b.y - a.y) * u, a.z + (b.z - a.z) * u, a.w + (b.w - a.w) * u);
+		}
+	};
+
+	// Plays tl forward while inside is true and backward from its end once inside turns false, like Tween does with
+	// a min and a max; a flip mid-play reverses from the current playhead. Every track is evaluated into out
+	// (GetTrackCount() values). Returns the playhead time.
+	inline float PlayTimeline(const char* id, bool inside, Timeline& tl, ImVec4* out, ImGuiTweenFlags flags = ImGuiTweenFlags_StartMin)
+	{
+		const float duration = tl.GetDuration();
+		const float p = TweenDetail::TweenProgress(id, inside, duration, duration, flags, true);
+		const float t = (inside ? p : 1.0f - p) * duration;
+		tl.EvaluateAll(t, out);
+		return t;
+	}
+}
@@ -0,0 +1,136 @@
+#pragma once
+#include <imgui.h>
+#include <imgui_internal.h>
+#include "imguiContextData.h"
+
+namespace AnimHelpers
+{
+    // --- color stop helpers (exact, float math) ---
+    static inline ImU32 LerpRGBA(ImU32 a, ImU32 b, float t)
+    {
+        ImVec4 ca = ImGui::ColorConvertU32ToFloat4(a);
+        ImVec4 cb = ImGui::ColorConvertU32ToFloat4(b);
+        ImVec4 cc = ImLerp(ca, cb, ImClamp(t, 0.0f, 1.0f));
+        return ImGui::ColorConvertFloat4ToU32(cc);
+    }
+
+    static inline ImU32 LerpHSV(ImU32 a, ImU32 b, float t)
+    {
+        auto u32_to_hsva = [](ImU32 c, float& h, float& s, float& v, float& a_out) {
+            ImVec4 cf = ImGui::ColorConvertU32ToFloat4(c);
+            ImGui::ColorConvertRGBtoHSV(cf.x, cf.y, cf.z, h, s, v);
+            a_out = cf.w;
+            };
+        float h1, s1, v1, a1, h2, s2, v2, a2;
+        u32_to_hsva(a, h1, s1, v1, a1);
+        u32_to_hsva(b, h2, s2, v2, a2);
+        // Shortest hue interpolation
+        float dh = h2 - h1;
+        if (dh > 0.5f)  dh -= 1.0f;
+        if (dh < -0.5f) dh += 1.0f;
+        float h = h1 + dh * t;
+        if (h < 0.0f) h += 1.0f;
+        if (h > 1.0f) h -= 1.0f;
+        float s = ImLerp(s1, s2, t);
+        float v = ImLerp(v1, v2, t);
+        float alpha = ImLerp(a1, a2, t);
+        ImVec4 rgb; ImGui::ColorConvertHSVtoRGB(h, s, v, rgb.x, rgb.y, rgb.z); rgb.w = alpha;
+        return ImGui::ColorConvertFloat4ToU32(rgb);
+    }
+
+    static inline ImU32 SampleStops(const ImU32* stops, int count, float u, bool use_hsv)
+    {
+        if (count <= 0) return IM_COL32_WHITE;
+        if (count == 1) return stops[0];
+
+        // u in [0,1] across the gradient; supports repeating if caller wraps it.
+        u = ImClamp(u, 0.0f, 1.0f);
+        float x = u * (count - 1);
+        int i = (int)floorf(x);
+        if (i >= count - 1) return stops[count - 1];
+        float t = x - i;
+        return use_hsv ? LerpHSV(stops[i], stops[i + 1], t)
+            : LerpRGBA(stops[i], stops[i + 1], t);
+    }
+}
+
+// Gradients baked into packed ImU32 lookup tables, so per-vertex (or per-pixel) sampling is one integer index and an
+// integer alpha multiply instead of float color conversions and an HSV round trip.
+namespace ImGui
+{
+    static const int GRADIENT_LUT_MIN_SIZE = 2;
+    static const int GRADIENT_LUT_MAX_SIZE = 1024;
+    static int GRADIENT_LUT_CACHE_CAPACITY = 64; // modify this (before first use) to change how many baked gradients each context keeps
+
+    struct GradientLut
+    {
+        ImVector<ImU32> Colors;  // Colors[i] = SampleStops(i / (Size - 1))
+        ImVector<ImU32> Stops;   // copy of the stops it was baked from, guards against hash collisions
+        bool            UseHsv = false;
+
+        int Size() const { return Colors.Size; }
+
+        void Bake(const ImU32* stops, int stop_count, bool use_hsv, int size = 256)
+        {
+            size = ImClamp(size, GRADIENT_LUT_MIN_SIZE, GRADIENT_LUT_MAX_SIZE);
+            stop_count = ImMax(stop_count, 0);
+            Stops.resize(stop_count);
+            if (stop_count > 0)
+                memcpy(Stops.Data, stops, (size_t)stop_count * sizeof(ImU32));
+            UseHsv = use_hsv;
+            Colors.resize(size);
+            const float inv = 1.0f / (float)(size - 1);
+            for (int i = 0; i < size; ++i)
+                Colors[i] = AnimHelpers::SampleStops(stops, stop_count, i * inv, use_hsv);
+        }
+
+        bool Matches(const ImU32* stops, int stop_count, bool use_hsv, int size) const
+        {
+            return UseHsv == use_hsv && Colors.Size == size && Stops.Size == stop_count &&
+                (stop_count == 0 || memcmp(Stops.Data, stops, (size_t)stop_count * sizeof(ImU32)) == 0);
+        }
+
+        // u in [0,1], nearest entry
+        ImU32 Sample(float u) const
+        {
+            return Colors[(int)(ImClamp(u, 0.0f, 1.0f) * (float)(Colors.Size - 1) + 0.5f)];
+        }
+
+        // Same, with the entry's alpha multiplied by alpha8 in [0,255]
+        ImU32 Sample(float u, ImU32 alpha8) const
+        {
+            const ImU32 c = Sample(u);
+            ImU32 a = ((c >> IM_COL32_A_SHIFT) & 0xFF) * alpha8 + 128;
+            a = (a + (a >> 8)) >> 8;
+            return (c & ~IM_COL32_A_MASK) | (a << IM_COL32_A_SHIFT);
+        }
+    };
+
+    struct GradientLutCache
+    {
+        IDLruCache<GradientLut> Luts;
+    };
+
+    // Returns the baked table for these stops, building it only the first time a given stop array / mode / size is seen.
+    // Stops are matched by value, so callers may pass a temporary array. The reference stays valid until the next call.
+    static inline const GradientLut& GetGradientLut(const ImU32* stops, int stop_count, bool use_hsv, int size = 256)
+    {
+        static const ImGuiID owner = ImHashStr("##GradientLutCache");
+        GradientLutCache* cache = GetContextData<GradientLutCache>(owner);
+        if (cache->Luts.Capacity() == 0)
+            cache->Luts.Init(GRADIENT_LUT_CACHE_CAPACITY);
+
+        size = ImClamp(size, GRADIENT_LUT_MIN_SIZE, GRADIENT_LUT_MAX_SIZE);
+        stop_count = ImMax(stop_count, 0);
+        const ImU32 seed = (ImU32)size * 2u + (use_hsv ? 1u : 0u);
+        ImGuiID key = ImHashData(stops, (size_t)stop_count * sizeof(ImU32), seed);
+        if (key == 0)
+            key = 1;
+
+        bool created = false;
+        GradientLut& lut = cache->Luts.Get(key, &created);
+        if (created || !lut.Matches(stops, stop_count, use_hsv, size))
+            lut.Bake(stops, stop_count, use_hsv, size);
+        return lut;
+    }
+}
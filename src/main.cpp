@@ -45,7 +45,7 @@ int main() {
 
     while (!glfwWindowShouldClose(window))
     {
-        glfwPollEvents();
+        DemoManager::WaitForNextFrame();
 
 		DemoManager::NewFrame();
 
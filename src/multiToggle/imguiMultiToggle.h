@@ -1,6 +1,9 @@
 #include <imgui.h>
 #include <imgui_internal.h>
 #include <vector>
+#include "imguiContextData.h"
+#include "imguiAnimClock.h"
+#include "easing.h"
 
 namespace ImGui
 {
@@ -12,7 +15,9 @@ namespace ImGui
 		float   gap = 8.f;     // gap between unequal sections
 		bool    equal_sections = true;    // true: even split; false: size by measured text
 		float   anim_speed = 0.12f;   // seconds across full lerp
+		const Easing::CubicBezier* easing_bezier = nullptr; // optional cubic-bezier curve (see ImGui::GetCubicBezier), used before easing
 		float (*easing)(float) = nullptr; // optional easing, e.g. Easing::easeInOutCubic
+		EasingKind easing_kind = EasingKind_Linear; // easing curve used when easing is nullptr
 
 		// Colors
         ImU32   col_track       = IM_COL32(125, 125, 125, 255);
@@ -100,8 +105,10 @@ namespace ImGui
         const ImGuiID wid = window->GetID(id);
         const ImGuiID kFrom = wid ^ 0x5101;  // int
         const ImGuiID kTo = wid ^ 0x5103;  // int
-        const ImGuiID kStart = wid ^ 0x5107;  // float
+        const ImGuiID kStart = wid ^ 0x5107;  // double (StorageSetTime)
         const ImGuiID kRun = wid ^ 0x510B;  // bool
+        const ImGuiID keys[] = { kFrom, kTo, kStart, StorageTimeKeyHi(kStart), kRun };
+        TouchWidgetState(window, wid, keys, IM_ARRAYSIZE(keys));
 
         bool changed = false;
 
@@ -118,7 +125,7 @@ namespace ImGui
                 // Start a fresh animation only when index actually changes
                 st->SetInt(kFrom, *current);
                 st->SetInt(kTo, desired);
-                st->SetFloat(kStart, (float)ImGui::GetTime());
+                StorageSetTime(st, kStart, GetAnimTime());
                 st->SetBool(kRun, true);
                 *current = desired;
                 changed = true;
@@ -132,11 +139,12 @@ namespace ImGui
         bool  run = st->GetBool(kRun, false);
         int   to = st->GetInt(kTo, *current);
         int   from = st->GetInt(kFrom, *current);
-        float stt = st->GetFloat(kStart, (float)ImGui::GetTime());
+        double stt = StorageGetTime(st, kStart, GetAnimTime());
 
         if (run) {
-            float norm = ImSaturate(((float)ImGui::GetTime() - stt) / ImMax(0.001f, cfg.anim_speed));
-            t01 = cfg.easing ? cfg.easing(norm) : norm;
+            float norm = ImSaturate(AnimTimeSince(stt) / ImMax(0.001f, cfg.anim_speed));
+            AnimActiveUntil(stt + ImMax(0.001f, cfg.anim_speed));
+            t01 = cfg.easing_bezier ? (*cfg.easing_bezier)(norm) : cfg.easing ? cfg.easing(norm) : Easing::Evaluate(cfg.easing_kind, norm);
             if (norm >= 1.0f) {
                 t01 = 1.0f;
                 st->SetBool(kRun, false);
@@ -29,7 +29,6 @@ void ProgressBarDemo::DrawSelectedDemo()
 	ImGui::TextLink("https://github.com/ocornut/imgui/issues/1901#issuecomment-1951343738");
 	ImGui::Separator();
 
-	float t = (float)ImGui::GetTime();
 	ImGui::BufferingBar(("Buffering Bar ##" + selector_name).c_str(), selection_progress_value, true);
 	(ImGui::Checkbox(("Manual Progress ##" + selector_name).c_str(), &stop_selection_progress));
 	if (stop_selection_progress) {
@@ -40,7 +39,7 @@ void ProgressBarDemo::DrawSelectedDemo()
         const float ramp_dur = 5.0f; 
         const float hold_dur = 0.2f; 
         const float period = ramp_dur + hold_dur * 2;
-        float phase = fmodf(t, period);
+        float phase = ImGui::AnimPhase(1.0 / period) * period;
 
         if (phase < ramp_dur) {
             selection_progress_value = phase / ramp_dur;
@@ -97,8 +96,7 @@ void ProgressBarDemo::DrawDemoPanel()
         // Drive target progress
         if (!manual)
         {
-            float t = (float)ImGui::GetTime();
-            progress = fmodf(t * auto_rate_hz, 1.0f); // wraps 0..1
+            progress = ImGui::AnimPhase(auto_rate_hz); // wraps 0..1
         }
 
         // Live widget
@@ -2,13 +2,17 @@
 #include <imgui_internal.h>
 #include <cmath>
 #include <functional>
+#include "imguiAnimMath.h"
+#include "imguiAnimClock.h"
+#include "easing.h"
 
 // based on spinner from
 // https://github.com/ocornut/imgui/issues/1901#issuecomment-552185000
 namespace spinnerdetails
 {
 	// cubic Bezier (0,0)  (0.4,0)  (0.2,1)  (1,1) : Fast In, Slow Out
-	constexpr inline float ease_bezier(float t) { return t * t * (3.0f - 2.0f * t); }
+	static constexpr Easing::CubicBezier kFastInSlowOut(0.4f, 0.0f, 0.2f, 1.0f);
+	inline float ease_bezier(float t) { return kFastInSlowOut(t); }
 
 	//  Linear map with clamp to [0, 1]
 	constexpr inline float interval(float t, float a, float b)
@@ -18,7 +22,7 @@ namespace spinnerdetails
 
 	// Saw-tooth that repeats N times over [0,1]
 	template<int N>
-	constexpr inline float saw(float t) { return std::fmod(t * N, 1.0f); }
+	inline float saw(float t) { return AnimMath::fast_fract(t * N); }
 }
 
 namespace ImGui
@@ -89,8 +93,7 @@ namespace ImGui
         }
 
         // Time base [0..1)
-        const float t = std::fmod(g.Time, (cfg.period > 0.0f ? cfg.period : 1.0f)) /
-            (cfg.period > 0.0f ? cfg.period : 1.0f);
+        const float t = ImGui::AnimPhase(1.0 / (cfg.period > 0.0f ? cfg.period : 1.0f));
 
         // Choose motion mode and compute [a_min, a_max]
         float a_min = 0.0f, a_max = 0.0f;
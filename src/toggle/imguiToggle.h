@@ -1,5 +1,7 @@
 #include <imgui.h>
 #include <imgui_internal.h>
+#include "easing.h"
+#include "imguiAnimClock.h"
 
 namespace ImGui
 {
@@ -17,7 +19,9 @@ namespace ImGui
 		ImU32    col_on_hnd = IM_COL32(255, 255, 255, 255);	            // on color for the handle
 		ImU32    col_off_hover_hnd = IM_COL32(240, 240, 240, 255);	    // hover color for the handle when toggle is off
 		ImU32    col_on_hover_hnd = IM_COL32(240, 240, 240, 255);	    // hover color for the handle when toggle is on
-		float  (*easingFunc)(float) = nullptr;						    // easing function for the animation, nullptr = linear
+		const Easing::CubicBezier* easingBezier = nullptr;			    // cubic-bezier curve (see ImGui::GetCubicBezier), used before easingFunc
+		float  (*easingFunc)(float) = nullptr;						    // easing function for the animation, nullptr = use easingKind
+		EasingKind easingKind = EasingKind_Linear;					    // easing curve used when easingFunc is nullptr
 		float    anim_speed = 0.08f;						            // seconds to full transition
 	};
 	// Toggle a switch with the given ID and value pointer. The toggle will animate between on/off states,
@@ -50,7 +54,9 @@ namespace ImGui
         if (g.LastActiveId == g.CurrentWindow->GetID(str_id))
         {
             float norm = ImSaturate(g.LastActiveIdTimer / cfg.anim_speed);
-            float eased = cfg.easingFunc ? cfg.easingFunc(norm) : norm;
+            if (norm < 1.0f)
+                ImGui::AnimActiveUntil(ImGui::GetAnimTime() + (cfg.anim_speed - g.LastActiveIdTimer));
+            float eased = cfg.easingBezier ? (*cfg.easingBezier)(norm) : cfg.easingFunc ? cfg.easingFunc(norm) : Easing::Evaluate(cfg.easingKind, norm);
             t = *state ? eased : (1.0f - eased);
         }
 
@@ -107,8 +107,8 @@ void ToggleDemo::DrawSelectedDemo()
         cfg.col_off_hnd = IM_COL32(0xE6, 0xE1, 0xE5, 255); // ~#E6E1E5
         cfg.col_off_hover_hnd = IM_COL32(0xF0, 0xEC, 0xF1, 255); // hover
 
-        // Animation (elastic, per request)
-        cfg.easingFunc = Easing::easeOutCubic;
+        // Animation: MD3 standard easing, cubic-bezier(0.2, 0, 0, 1)
+        cfg.easingBezier = &ImGui::GetCubicBezier(0.2f, 0.0f, 0.0f, 1.0f);
         cfg.anim_speed = 0.28f;
 
         ImGui::Text("Material Purple (Dark Mode)");
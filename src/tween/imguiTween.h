@@ -1,6 +1,19 @@
+#pragma once
 #include <imgui.h>
 #include <imgui_internal.h>
 #include <functional>
+#include <type_traits>
+#include "imguiContextData.h"
+#include "imguiAnimClock.h"
+#include "easing.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define IMGUI_TWEEN_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define IMGUI_TWEEN_NEON 1
+#include <arm_neon.h>
+#endif
 
 // Flags for ImGui::Tween
 enum ImGuiTweenFlags
@@ -12,6 +25,260 @@ enum ImGuiTweenFlags
 
 namespace ImGui
 {
+	// Compile-time easing tags for the callable Tween overload, e.g. ImGui::Tween(id, inside, up, down, a, b, flags, ImGui::TweenEase::OutCubic{}).
+	// Being empty types with a constexpr call operator, they are always inlined.
+	namespace TweenEase
+	{
+		struct Linear     { constexpr float operator()(float t) const { return t; } };
+		struct InQuad     { constexpr float operator()(float t) const { return t * t; } };
+		struct OutQuad    { constexpr float operator()(float t) const { return 1.0f - (1.0f - t) * (1.0f - t); } };
+		struct InOutQuad  { constexpr float operator()(float t) const { return t < 0.5f ? 2.0f * t * t : 1.0f - 2.0f * (1.0f - t) * (1.0f - t); } };
+		struct InCubic    { constexpr float operator()(float t) const { return t * t * t; } };
+		struct OutCubic   { constexpr float operator()(float t) const { return 1.0f - (1.0f - t) * (1.0f - t) * (1.0f - t); } };
+		struct InOutCubic { constexpr float operator()(float t) const { return t < 0.5f ? 4.0f * t * t * t : 1.0f - 4.0f * (1.0f - t) * (1.0f - t) * (1.0f - t); } };
+		struct SmoothStep { constexpr float operator()(float t) const { return t * t * (3.0f - 2.0f * t); } };
+
+		// Wraps any float(float) function as a tag, e.g. TweenEase::Fn<Easing::easeOutBounce>{}
+		template<float (*F)(float)>
+		struct Fn { float operator()(float t) const { return F(t); } };
+
+		// Any EasingKind, resolved at compile time, e.g. TweenEase::Kind<EasingKind_OutBack>{}
+		template<EasingKind K>
+		struct Kind { float operator()(float t) const { return Easing::Evaluate(K, t); } };
+
+		// An EasingKind picked at run time (e.g. from a combo). lut: read elastic/bounce from their tables.
+		struct ByKind
+		{
+			EasingKind kind;
+			bool       lut;
+			ByKind(EasingKind k, bool use_lut = false) : kind(k), lut(use_lut) {}
+			float operator()(float t) const { return lut ? Easing::EvaluateLut(kind, t) : Easing::Evaluate(kind, t); }
+		};
+	}
+
+	// Default interpolation of the callable Tween overload
+	struct TweenLerp
+	{
+		template<typename T>
+		T operator()(const T& a, const T& b, float t) const { return ImLerp(a, b, t); }
+	};
+
+	static int TWEEN_STALE_FRAMES = 600;     // a tween not submitted for this many frames has its state reclaimed (it restarts from its default)
+	static int TWEEN_SWEEP_PER_FRAME = 64;   // tween slots checked for staleness per frame
+
+	// State of every tween of a context, as packed parallel arrays indexed through an ID -> slot map.
+	// A tween costs one hash lookup per frame; removal swaps the last slot in, so the arrays stay dense.
+	struct TweenPool
+	{
+		IDSlotMap         Map;
+		ImVector<ImGuiID> Ids;
+		ImVector<double>  StartTime;    // start time of the current tween (GetAnimTime)
+		ImVector<bool>    Inside;       // last value of inside
+		ImVector<int>     LastFrame;    // frame the tween was last submitted
+		// snapshot used by ResetTween
+		ImVector<bool>    InitValid;
+		ImVector<bool>    InitInside;
+		ImVector<float>   InitT;
+		ImVector<float>   InitUp;
+		ImVector<float>   InitDown;
+		int               SweepCursor = 0;
+		int               SweepFrame = -1;
+		int               ReclaimedTotal = 0;   // tweens reclaimed since the context was created
+
+		int Size() const { return Ids.Size; }
+
+		int Add(ImGuiID id, bool inside, double start_time)
+		{
+			const int slot = Ids.Size;
+			Ids.push_back(id);
+			StartTime.push_back(start_time);
+			Inside.push_back(inside);
+			LastFrame.push_back(0);
+			InitValid.push_back(false);
+			InitInside.push_back(false);
+			InitT.push_back(0.0f);
+			InitUp.push_back(0.0f);
+			InitDown.push_back(0.0f);
+			Map.Insert(id, slot);
+			return slot;
+		}
+
+		void Remove(int slot)
+		{
+			const int last = Ids.Size - 1;
+			Map.Remove(Ids[slot]);
+			if (slot != last)
+			{
+				Ids[slot] = Ids[last];
+				StartTime[slot] = StartTime[last];
+				Inside[slot] = Inside[last];
+				LastFrame[slot] = LastFrame[last];
+				InitValid[slot] = InitValid[last];
+				InitInside[slot] = InitInside[last];
+				InitT[slot] = InitT[last];
+				InitUp[slot] = InitUp[last];
+				InitDown[slot] = InitDown[last];
+				Map.Insert(Ids[slot], slot);
+			}
+			Ids.pop_back(); StartTime.pop_back(); Inside.pop_back(); LastFrame.pop_back();
+			InitValid.pop_back(); InitInside.pop_back(); InitT.pop_back(); InitUp.pop_back(); InitDown.pop_back();
+		}
+
+		// Removes up to max_checks slots (round robin) not submitted within max_idle_frames. Returns how many were removed.
+		int Sweep(int frame, int max_idle_frames, int max_checks)
+		{
+			int removed = 0;
+			for (int n = 0; n < max_checks && Ids.Size > 0; ++n)
+			{
+				if (SweepCursor >= Ids.Size)
+					SweepCursor = 0;
+				if (frame - LastFrame[SweepCursor] > max_idle_frames)
+				{
+					Remove(SweepCursor); // the swapped in slot is checked next
+					removed++;
+					ReclaimedTotal++;
+				}
+				else
+					SweepCursor++;
+			}
+			return removed;
+		}
+	};
+
+	inline TweenPool& GetTweenPool()
+	{
+		static const ImGuiID owner = ImHashStr("##TweenPool");
+		return *GetContextData<TweenPool>(owner);
+	}
+
+	namespace TweenDetail
+	{
+		// nullptr, null function pointers and empty std::functions mean "no easing" / "default lerp".
+		// Lambdas are never null (even captureless ones, which would convert to bool through a function pointer).
+		template<typename D> struct IsNullable : std::is_pointer<D> {};
+		template<typename S> struct IsNullable<std::function<S>> : std::true_type {};
+
+		template<typename F>
+		inline float ApplyEase(F& ease, float t)
+		{
+			using D = typename std::decay<F>::type;
+			if constexpr (std::is_same<D, std::nullptr_t>::value)
+				return t;
+			else if constexpr (std::is_function<F>::value) // function lvalue, never null
+				return ease(t);
+			else if constexpr (IsNullable<D>::value)
+				return ease ? ease(t) : t;
+			else
+				return ease(t);
+		}
+
+		template<typename T, typename F>
+		inline T ApplyLerp(F& lerp, const T& a, const T& b, float t)
+		{
+			using D = typename std::decay<F>::type;
+			if constexpr (std::is_same<D, std::nullptr_t>::value)
+				return ImLerp(a, b, t);
+			else if constexpr (std::is_function<F>::value)
+				return lerp(a, b, t);
+			else if constexpr (IsNullable<D>::value)
+				return lerp ? lerp(a, b, t) : ImLerp(a, b, t);
+			else
+				return lerp(a, b, t);
+		}
+
+		template<typename T, typename EaseF, typename LerpF>
+		inline T TweenImpl(const char* id, bool inside, float upDur, float downDur, const T& min, const T& max, ImGuiTweenFlags flags,
+			EaseF& easeFunc, LerpF& lerpFunc);
+
+		// Linear progress [0,1] of the tween id in the current direction. Creates and updates its pool slot.
+		// With continuous, a direction flip mid-run starts the new direction at 1 - the old progress instead of 0.
+		inline float TweenProgress(const char* id, bool inside, float upDur, float downDur, ImGuiTweenFlags flags, bool continuous = false)
+		{
+			ImGuiContext& g = *GImGui;
+			ImGuiWindow* window = ImGui::GetCurrentWindowRead(); // prevents the creation of debug windows
+			const ImGuiID key = window->GetID(id);
+			TweenPool& pool = GetTweenPool();
+
+			// Reclaim a few stale tweens once per frame, before any slot index is taken
+			if (pool.SweepFrame != g.FrameCount)
+			{
+				pool.SweepFrame = g.FrameCount;
+				pool.Sweep(g.FrameCount, TWEEN_STALE_FRAMES, TWEEN_SWEEP_PER_FRAME);
+			}
+
+			// we store the last state and time in the context's tween pool to ensure all tweens are independent
+			// without forcing the user to store their own states
+			const double now = GetAnimTime();
+			int slot = pool.Map.Find(key);
+			if (slot < 0)
+			{
+				const bool defaultInside = (flags & ImGuiTweenFlags_StartMax);
+				slot = pool.Add(key, defaultInside, now - (defaultInside ? upDur : downDur));
+			}
+			pool.LastFrame[slot] = g.FrameCount;
+
+			const bool prevInside = pool.Inside[slot];
+			double startTime = pool.StartTime[slot];
+
+			if (inside != prevInside)
+			{
+				startTime = now;
+				if (continuous)
+				{
+					const float prevDur = prevInside ? upDur : downDur;
+					const float prevT = prevDur > 0.0f ? ImSaturate(AnimClock::Since(now, pool.StartTime[slot]) / prevDur) : 1.0f;
+					startTime = now - (double)((1.0f - prevT) * (inside ? upDur : downDur));
+				}
+				pool.StartTime[slot] = startTime;
+				pool.Inside[slot] = inside;
+				pool.InitValid[slot] = false;
+			}
+
+			float duration = inside ? upDur : downDur;
+			float t = duration > 0.0f
+				? ImSaturate(AnimClock::Since(now, startTime) / duration)
+				: 1.0f;
+			if (t < 1.0f)
+				AnimActiveUntil(startTime + duration);
+
+			// capture initial parameters on first run
+			if (!pool.InitValid[slot])
+			{
+				pool.InitValid[slot] = true;
+				pool.InitInside[slot] = inside;
+				pool.InitT[slot] = t;
+				pool.InitUp[slot] = upDur;
+				pool.InitDown[slot] = downDur;
+			}
+			return t;
+		}
+
+		// out[i] = a[i] + (b[i] - a[i]) * t, 4 floats per step with SSE2 / NEON. out may alias a or b.
+		static inline void LerpFloats(const float* a, const float* b, float* out, int count, float t)
+		{
+			int i = 0;
+#if defined(IMGUI_TWEEN_SSE2)
+			const __m128 vt = _mm_set1_ps(t);
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128 va = _mm_loadu_ps(a + i);
+				const __m128 vb = _mm_loadu_ps(b + i);
+				_mm_storeu_ps(out + i, _mm_add_ps(va, _mm_mul_ps(_mm_sub_ps(vb, va), vt)));
+			}
+#elif defined(IMGUI_TWEEN_NEON)
+			const float32x4_t vt = vdupq_n_f32(t);
+			for (; i + 4 <= count; i += 4)
+			{
+				const float32x4_t va = vld1q_f32(a + i);
+				const float32x4_t vb = vld1q_f32(b + i);
+				vst1q_f32(out + i, vaddq_f32(va, vmulq_f32(vsubq_f32(vb, va), vt)));
+			}
+#endif
+			for (; i < count; ++i)
+				out[i] = a[i] + (b[i] - a[i]) * t;
+		}
+	}
+
 	// Tween a value between min and max based on the inside state, with customizable durations and easing functions.
 	// Each tween is independent and can be controlled by the user, and hence must have a unique ID provided by the user.
 	template<typename T>
@@ -19,89 +286,91 @@ namespace ImGui
 		std::function<float(float)> easeFunc = nullptr,
 		std::function<T(const T&, const T&, float)> lerpFunc = [](const T& a, const T& b, float t) { return ImLerp(a, b, t); })
 	{
-		ImGuiWindow* window = ImGui::GetCurrentWindowRead(); // prevents the creation of debug windows
-		ImGuiStorage* storage = window->DC.StateStorage;
-		ImGuiID       keyBase = window->GetID(id);
-		ImGuiID       keyTime = keyBase ^ 0x1111; // stores start-time of current tween
-		ImGuiID       keyState = keyBase ^ 0x3333; // stores last value of inside
-
-		// snapshot keys
-		ImGuiID keyInitValid = keyBase ^ 0xAAAA;
-		ImGuiID keyInitIns	 = keyBase ^ 0xBBBB;
-		ImGuiID keyInitT	 = keyBase ^ 0xCCCC;
-		ImGuiID keyInitUp	 = keyBase ^ 0xDDDD;
-		ImGuiID keyInitDown  = keyBase ^ 0xEEEE;
-
-		// we store the last state and time inside state storage to ensure all tweens are independent
-		// without forcing the user to store their own states
-		bool defaultInside = (flags & ImGuiTweenFlags_StartMax);
-		float defaultStartTime = ImGui::GetTime() - (defaultInside ? upDur : downDur);
-
-		bool   prevInside = storage->GetBool(keyState, defaultInside);
-		float  startTime = storage->GetFloat(keyTime, defaultStartTime);
-		float  now = ImGui::GetTime();
-
-		if (inside != prevInside)
-		{
-			startTime = now;
-			storage->SetFloat(keyTime, now);
-			storage->SetBool(keyState, inside);
-			storage->SetBool(keyInitValid, false);
-		}
+		return TweenDetail::TweenImpl(id, inside, upDur, downDur, min, max, flags, easeFunc, lerpFunc);
+	}
 
-		float duration = inside ? upDur : downDur;
-		float t = duration > 0.0f
-			? ImSaturate((now - startTime) / duration)
-			: 1.0f;
-		float et = easeFunc ? easeFunc(t) : t;
+	// Same, taking the easing and interpolation as plain callables (lambdas, function pointers, TweenEase tags, ...).
+	// Nothing is type-erased, so the easing and lerp inline into the tween and no std::function is built per call.
+	// Picked over the std::function overload whenever an easing argument is passed.
+	template<typename T, typename EaseF, typename LerpF = TweenLerp>
+	inline T Tween(const char* id, bool inside, float upDur, float downDur, const T& min, const T& max, ImGuiTweenFlags flags,
+		EaseF&& easeFunc, LerpF&& lerpFunc = LerpF())
+	{
+		return TweenDetail::TweenImpl(id, inside, upDur, downDur, min, max, flags, easeFunc, lerpFunc);
+	}
 
-		// capture initial parameters on first run
-		if (!storage->GetBool(keyInitValid, false))
-		{
-			storage->SetBool(keyInitValid, true);
-			storage->SetBool(keyInitIns, inside);
-			storage->SetFloat(keyInitT, t);
-			storage->SetFloat(keyInitUp, upDur);
-			storage->SetFloat(keyInitDown, downDur);
-		}
+	template<typename T, typename EaseF, typename LerpF>
+	inline T TweenDetail::TweenImpl(const char* id, bool inside, float upDur, float downDur, const T& min, const T& max, ImGuiTweenFlags flags,
+		EaseF& easeFunc, LerpF& lerpFunc)
+	{
+		float t = TweenProgress(id, inside, upDur, downDur, flags);
+		float et = ApplyEase(easeFunc, t);
 
 		const T& a = inside ? min : max;
 		const T& b = inside ? max : min;
 
-		return lerpFunc(a, b, et);
+		return ApplyLerp(lerpFunc, a, b, et);
+	}
+
+	// Tweens count values at once on a single clock: out[i] goes from min[i] to max[i] (and back) like Tween would,
+	// but the whole array shares one state record and the easing is evaluated once per call. float, ImVec2 and ImVec4
+	// arrays are interpolated 4 floats at a time; other types use lerpFunc per element. out may alias min or max.
+	// Returns the eased progress in the current direction, e.g. to know when a transition has finished.
+	template<typename T, typename EaseF = TweenEase::Linear, typename LerpF = TweenLerp>
+	inline float TweenArray(const char* id, bool inside, float upDur, float downDur, const T* min, const T* max, T* out, int count,
+		ImGuiTweenFlags flags = ImGuiTweenFlags_StartMin, EaseF&& easeFunc = EaseF(), LerpF&& lerpFunc = LerpF())
+	{
+		const float t = TweenDetail::TweenProgress(id, inside, upDur, downDur, flags);
+		const float et = TweenDetail::ApplyEase(easeFunc, t);
+		const T* a = inside ? min : max;
+		const T* b = inside ? max : min;
+
+		constexpr bool is_float_vec = std::is_same<T, float>::value || std::is_same<T, ImVec2>::value || std::is_same<T, ImVec4>::value;
+		if constexpr (is_float_vec && std::is_same<typename std::decay<LerpF>::type, TweenLerp>::value)
+		{
+			constexpr int floats = (int)(sizeof(T) / sizeof(float));
+			static_assert(sizeof(T) == floats * sizeof(float), "T must be tightly packed floats");
+			TweenDetail::LerpFloats((const float*)a, (const float*)b, (float*)out, count * floats, et);
+		}
+		else
+		{
+			for (int i = 0; i < count; ++i)
+				out[i] = TweenDetail::ApplyLerp(lerpFunc, a[i], b[i], et);
+		}
+		return et;
 	}
 
 	inline void ResetTween(const char* id)
 	{
 		ImGuiWindow* window = ImGui::GetCurrentWindowRead();
-		ImGuiStorage* storage = window->DC.StateStorage;
-		ImGuiID keyBase = window->GetID(id);
-		ImGuiID keyTime = keyBase ^ 0x1111;
-		ImGuiID keyState = keyBase ^ 0x3333;
-
-		ImGuiID keyInitValid = keyBase ^ 0xAAAA;
-		ImGuiID keyInitIns = keyBase ^ 0xBBBB;
-		ImGuiID keyInitT = keyBase ^ 0xCCCC;
-		ImGuiID keyInitUp = keyBase ^ 0xDDDD;
-		ImGuiID keyInitDown = keyBase ^ 0xEEEE;
-
-		if (!storage->GetBool(keyInitValid, false))
+		TweenPool& pool = GetTweenPool();
+		const int slot = pool.Map.Find(window->GetID(id));
+		if (slot < 0 || !pool.InitValid[slot])
 			return; // nothing captured yet
 
-		const bool  init_inside = storage->GetBool(keyInitIns, false);
-		const float init_t = ImClamp(storage->GetFloat(keyInitT, 0.0f), 0.0f, 1.0f);
-		const float upDur0 = ImMax(storage->GetFloat(keyInitUp, 0.0f), 0.0f);
-		const float downDur0 = ImMax(storage->GetFloat(keyInitDown, 0.0f), 0.0f);
+		const bool  init_inside = pool.InitInside[slot];
+		const float init_t = ImClamp(pool.InitT[slot], 0.0f, 1.0f);
+		const float upDur0 = ImMax(pool.InitUp[slot], 0.0f);
+		const float downDur0 = ImMax(pool.InitDown[slot], 0.0f);
 		const float dur0 = init_inside ? upDur0 : downDur0;
 
 		// Set logical direction back
-		storage->SetBool(keyState, init_inside);
+		pool.Inside[slot] = init_inside;
 
 		// Rebuild start time so that next tween computes t == init_t
-		float now = ImGui::GetTime();
+		const double now = GetAnimTime();
 		if (dur0 > 0.0f)
-			storage->SetFloat(keyTime, now - init_t * dur0);
+			pool.StartTime[slot] = now - (double)(init_t * dur0);
 		else
-			storage->SetFloat(keyTime, now); // duration == 0 returns t = 1.0 anyway
+			pool.StartTime[slot] = now; // duration == 0 returns t = 1.0 anyway
+	}
+
+	// Drops the state of every tween not submitted within max_idle_frames frames (default TWEEN_STALE_FRAMES) right away,
+	// instead of waiting for the incremental sweep. Returns how many were reclaimed.
+	inline int GcTweens(int max_idle_frames = -1)
+	{
+		TweenPool& pool = GetTweenPool();
+		pool.SweepCursor = 0;
+		return pool.Sweep(GImGui->FrameCount, max_idle_frames >= 0 ? max_idle_frames : TWEEN_STALE_FRAMES, pool.Size());
 	}
 }
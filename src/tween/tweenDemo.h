@@ -1,6 +1,9 @@
 #pragma once
 #include "imguiTween.h"
+#include "imguiTimeline.h"
+#include "imguiSpring.h"
 #include "demo_module.h"
+#include <chrono>
 
 class TweenDemo : public DemoModule
 {
@@ -28,8 +31,216 @@ protected:
 	void DrawDemoPanel() override;
 
 	void AnimatedWindowDemo();
+	void ArrayTweenDemo();
+	void TimelineDemo();
+	void SpringDemo();
+	void BezierDemo();
 };
 
+void TweenDemo::SpringDemo()
+{
+    static float halflife = 0.08f;
+    ImGui::TextDisabled("Springs");
+    DrawHelpTooltip("ImGui::Spring follows a target that can change every frame, keeping its velocity when the target moves. "
+        "Below, the dot follows the mouse and the list rows glide to their new places after a shuffle (one SpringBatch call).");
+    ImGui::SetNextItemWidth(160.0f);
+    ImGui::SliderFloat("Half-life (s)", &halflife, 0.01f, 0.5f, "%.2f");
+
+    // Follower: the target is the mouse, moving every frame
+    const ImVec2 p = ImGui::GetCursorScreenPos();
+    const ImVec2 size(ImGui::GetContentRegionAvail().x, 40.0f);
+    ImGui::InvisibleButton("##spring_strip", size);
+    const float target_x = ImGui::IsItemHovered() ? ImGui::GetIO().MousePos.x : p.x + size.x * 0.5f;
+    const float x = ImGui::Spring("spring.dot", target_x, halflife);
+    ImDrawList* dl = ImGui::GetWindowDrawList();
+    dl->AddRectFilled(p, p + size, ImGui::GetColorU32(ImGuiCol_FrameBg), 4.0f);
+    dl->AddCircle(ImVec2(target_x, p.y + size.y * 0.5f), 10.0f, ImGui::GetColorU32(ImGuiCol_TextDisabled));
+    dl->AddCircleFilled(ImVec2(x, p.y + size.y * 0.5f), 8.0f, ImGui::GetColorU32(ImGuiCol_PlotHistogram));
+
+    // Reorderable list: each row is followed by its own id, so it glides from wherever it was
+    const int row_count = 6;
+    static const char* labels[row_count] = { "Apples", "Bananas", "Cherries", "Dates", "Elderberries", "Figs" };
+    static int order[row_count] = { 0, 1, 2, 3, 4, 5 };
+    if (ImGui::Button("Shuffle"))
+        for (int i = row_count - 1; i > 0; --i)
+            ImSwap(order[i], order[rand() % (i + 1)]);
+    ImGui::SameLine();
+    if (ImGui::Button("Sort"))
+        for (int i = 0; i < row_count; ++i)
+            order[i] = i;
+
+    const float row_h = ImGui::GetFrameHeight();
+    ImGuiID ids[row_count];
+    float targets[row_count], ys[row_count];
+    for (int slot = 0; slot < row_count; ++slot)
+    {
+        ids[order[slot]] = (ImGuiID)(order[slot] + 1);
+        targets[order[slot]] = slot * (row_h + 2.0f);
+    }
+    ImGui::SpringBatch(ids, targets, ys, row_count, halflife);
+
+    const ImVec2 lp = ImGui::GetCursorScreenPos();
+    const float list_w = ImMin(ImGui::GetContentRegionAvail().x, 240.0f);
+    for (int i = 0; i < row_count; ++i)
+    {
+        const ImVec2 r0(lp.x, lp.y + ys[i]);
+        dl->AddRectFilled(r0, ImVec2(r0.x + list_w, r0.y + row_h), ImGui::GetColorU32(ImGuiCol_Button), 3.0f);
+        dl->AddText(ImVec2(r0.x + 8.0f, r0.y + ImGui::GetStyle().FramePadding.y), ImGui::GetColorU32(ImGuiCol_Text), labels[i]);
+    }
+    ImGui::Dummy(ImVec2(list_w, row_count * (row_h + 2.0f)));
+}
+
+void TweenDemo::BezierDemo()
+{
+    struct Preset { const char* name; float ctrl[4]; };
+    static const Preset presets[] = {
+        { "ease",          { 0.25f, 0.1f, 0.25f, 1.0f } },
+        { "ease-in",       { 0.42f, 0.0f, 1.0f, 1.0f } },
+        { "ease-out",      { 0.0f, 0.0f, 0.58f, 1.0f } },
+        { "ease-in-out",   { 0.42f, 0.0f, 0.58f, 1.0f } },
+        { "MD3 standard",  { 0.2f, 0.0f, 0.0f, 1.0f } },
+        { "back in-out",   { 0.68f, -0.6f, 0.32f, 1.6f } },
+    };
+    static float ctrl[4] = { 0.25f, 0.1f, 0.25f, 1.0f };
+    static int preset_idx = 0;
+
+    ImGui::TextDisabled("Cubic Bezier");
+    DrawHelpTooltip("CSS style cubic-bezier(x1, y1, x2, y2) curves. Easing::CubicBezier solves x -> t from a table of samples "
+        "with Newton-Raphson (bisection on flat parts); ImGui::GetCubicBezier caches one per set of control points, "
+        "for use in Tween, ToggleConfig::easingBezier and MultiToggleConfig::easing_bezier.");
+    ImGui::SetNextItemWidth(160.0f);
+    if (ImGui::BeginCombo("Preset", presets[preset_idx].name))
+    {
+        for (int i = 0; i < IM_ARRAYSIZE(presets); ++i)
+            if (ImGui::Selectable(presets[i].name, i == preset_idx))
+            {
+                preset_idx = i;
+                memcpy(ctrl, presets[i].ctrl, sizeof(ctrl));
+            }
+        ImGui::EndCombo();
+    }
+    ImGui::SetNextItemWidth(320.0f);
+    ImGui::DragFloat4("x1 y1 x2 y2", ctrl, 0.005f, -1.0f, 2.0f, "%.2f");
+    const Easing::CubicBezier curve(ctrl[0], ctrl[1], ctrl[2], ctrl[3]); // edited live, so not cached
+
+    // Curve, with the control polygon
+    const ImVec2 p = ImGui::GetCursorScreenPos();
+    const float side = 120.0f, pad = 30.0f;
+    ImGui::InvisibleButton("##bezier_plot", ImVec2(side, side + pad * 2.0f));
+    const bool hovered = ImGui::IsItemHovered();
+    ImDrawList* dl = ImGui::GetWindowDrawList();
+    auto to_screen = [&](float x, float y) { return ImVec2(p.x + x * side, p.y + pad + (1.0f - y) * side); };
+    dl->AddRect(to_screen(0.0f, 1.0f), to_screen(1.0f, 0.0f), ImGui::GetColorU32(ImGuiCol_Border));
+    dl->AddLine(to_screen(0.0f, 0.0f), to_screen(curve.X1, curve.Y1), ImGui::GetColorU32(ImGuiCol_TextDisabled));
+    dl->AddLine(to_screen(1.0f, 1.0f), to_screen(curve.X2, curve.Y2), ImGui::GetColorU32(ImGuiCol_TextDisabled));
+    const int segments = 48;
+    ImVec2 pts[segments + 1];
+    for (int i = 0; i <= segments; ++i)
+    {
+        const float x = (float)i / segments;
+        pts[i] = to_screen(x, curve(x));
+    }
+    dl->AddPolyline(pts, segments + 1, ImGui::GetColorU32(ImGuiCol_PlotLines), ImDrawFlags_None, 2.0f);
+
+    // Hover the plot: the dot runs along the curve (linear tween of x), the bar below is a tween eased by the curve
+    const float x = ImGui::Tween<float>("bezier.x", hovered, 0.6f, 0.6f, 0.0f, 1.0f);
+    const float u = ImGui::Tween<float>("bezier.bar", hovered, 0.6f, 0.6f, 0.0f, 1.0f, ImGuiTweenFlags_StartMin, curve);
+    dl->AddCircleFilled(to_screen(x, curve(x)), 4.0f, ImGui::GetColorU32(ImGuiCol_PlotHistogram));
+    const ImVec2 bar = to_screen(0.0f, 0.0f);
+    dl->AddRectFilled(ImVec2(bar.x, bar.y + pad * 0.5f), ImVec2(bar.x + 6.0f + u * (side - 6.0f), bar.y + pad * 0.5f + 6.0f),
+        ImGui::GetColorU32(ImGuiCol_PlotHistogram), 3.0f);
+
+    // Solver check: largest |x(t(x)) - x| over 10,001 points
+    float max_err = 0.0f;
+    for (int i = 0; i <= 10000; ++i)
+    {
+        const float x = i * 1e-4f;
+        max_err = ImMax(max_err, fabsf(curve.SampleX(curve.SolveT(x)) - x));
+    }
+    ImGui::SameLine();
+    ImGui::BeginGroup();
+    ImGui::Text("cubic-bezier(%.2f, %.2f, %.2f, %.2f)", curve.X1, curve.Y1, curve.X2, curve.Y2);
+    ImGui::Text("solver max x error: %.2g", max_err);
+    ImGui::TextDisabled("hover the plot to play it");
+    ImGui::EndGroup();
+}
+
+void TweenDemo::TimelineDemo()
+{
+    // A notification card: grows in, then the title and the body fade in one after the other while the accent color settles
+    static ImGui::Timeline tl;
+    static int t_width, t_title, t_body, t_accent;
+    if (tl.GetTrackCount() == 0)
+    {
+        t_width = tl.AddTrack(40.0f);
+        t_title = tl.AddTrack(0.0f);
+        t_body = tl.AddTrack(0.0f);
+        t_accent = tl.AddTrack(ImVec4(1.0f, 0.6f, 0.2f, 1.0f));
+        tl.BeginParallel();
+            tl.To(t_width, 320.0f, 0.35f, Easing::easeOutCubic);
+            tl.BeginSequence();
+                tl.Wait(0.2f);
+                tl.To(t_title, 1.0f, 0.2f);
+                tl.To(t_body, 1.0f, 0.3f, Easing::easeInOutQuad);
+            tl.End();
+            tl.To(t_accent, ImVec4(0.35f, 0.55f, 1.0f, 1.0f), 0.7f);
+        tl.End();
+        tl.Compile();
+    }
+
+    ImGui::TextDisabled("Timeline (hover the card, %.2f s)", tl.GetDuration());
+    DrawHelpTooltip("One ImGui::Timeline with 4 tracks laid out in parallel and sequenced groups, played forward while hovered "
+        "and backward afterwards by ImGui::PlayTimeline. All tracks are evaluated in one call.");
+    const ImVec2 p = ImGui::GetCursorScreenPos();
+    const ImVec2 size(320.0f, 56.0f);
+    ImGui::InvisibleButton("##timeline_card", size);
+    ImVec4 v[4];
+    ImGui::PlayTimeline("timeline.card", ImGui::IsItemHovered(), tl, v);
+
+    ImDrawList* dl = ImGui::GetWindowDrawList();
+    const ImVec2 p1(p.x + v[t_width].x, p.y + size.y);
+    dl->AddRectFilled(p, p1, ImGui::GetColorU32(ImGuiCol_FrameBg), 6.0f);
+    dl->AddRectFilled(p, ImVec2(p.x + 5.0f, p1.y), ImGui::GetColorU32(v[t_accent]), 6.0f, ImDrawFlags_RoundCornersLeft);
+    dl->PushClipRect(p, p1, true);
+    dl->AddText(ImVec2(p.x + 14.0f, p.y + 8.0f), ImGui::GetColorU32(ImGuiCol_Text, v[t_title].x), "Build finished");
+    dl->AddText(ImVec2(p.x + 14.0f, p.y + 30.0f), ImGui::GetColorU32(ImGuiCol_TextDisabled, v[t_body].x), "0 errors, 2 warnings");
+    dl->PopClipRect();
+}
+
+void TweenDemo::ArrayTweenDemo()
+{
+    // A bar chart switching between two datasets: every bar is tweened by one TweenArray call sharing one clock
+    const int bar_count = 48;
+    static float data_a[bar_count], data_b[bar_count], bars[bar_count];
+    static bool init = false, show_b = false;
+    if (!init)
+    {
+        for (int i = 0; i < bar_count; ++i)
+        {
+            data_a[i] = 0.55f + 0.40f * sinf(i * 0.21f);
+            data_b[i] = 0.15f + 0.80f * (float)((i * 37 + 11) % 23) / 22.0f;
+        }
+        init = true;
+    }
+    ImGui::Checkbox("Show dataset B", &show_b);
+    DrawHelpTooltip("All 48 bars are animated by a single ImGui::TweenArray call (one state record, one easing evaluation).");
+    ImGui::TweenArray("chart.bars", show_b, 0.45f, 0.45f, data_a, data_b, bars, bar_count,
+        ImGuiTweenFlags_StartMin, ImGui::TweenEase::InOutCubic{});
+
+    const ImVec2 size(ImGui::GetContentRegionAvail().x, 90.0f);
+    const ImVec2 p = ImGui::GetCursorScreenPos();
+    ImDrawList* dl = ImGui::GetWindowDrawList();
+    dl->AddRectFilled(p, p + size, ImGui::GetColorU32(ImGuiCol_FrameBg), 4.0f);
+    const float bar_w = size.x / bar_count;
+    for (int i = 0; i < bar_count; ++i)
+    {
+        const float x = p.x + i * bar_w;
+        dl->AddRectFilled(ImVec2(x + 1.0f, p.y + size.y * (1.0f - bars[i])), ImVec2(x + bar_w - 1.0f, p.y + size.y),
+            ImGui::GetColorU32(ImGuiCol_PlotHistogram));
+    }
+    ImGui::Dummy(size);
+}
+
 void TweenDemo::AnimatedWindowDemo()
 {
     // Example setup
@@ -201,6 +412,14 @@ void TweenDemo::DrawSelectedDemo()
     ImGui::SeparatorText("Addition Tween Demos");
     AnimatedWindowDemo();
     ImGui::Spacing();
+    ArrayTweenDemo();
+    ImGui::Spacing();
+    TimelineDemo();
+    ImGui::Spacing();
+    SpringDemo();
+    ImGui::Spacing();
+    BezierDemo();
+    ImGui::Spacing();
     ImGui::Spacing();
 }
 
@@ -235,9 +454,8 @@ void TweenDemo::DrawDemoPanel()
         {
             // Auto loop: inside true during [0, upDur], false during [upDur, upDur+downDur],
             // with an optional pause at each end.
-            float t = (float)ImGui::GetTime();
             float period = ImMax(0.0001f, upDur + downDur + 2.0f * auto_pause);
-            float phase = fmodf(t, period);
+            float phase = ImGui::AnimPhase(1.0 / period) * period;
             inside = (phase <= (upDur + auto_pause));
         }
 
@@ -403,6 +621,158 @@ void TweenDemo::DrawDemoPanel()
         ImGui::EndTable();
     }
 
+    // ------------------------ BENCHMARK ------------------------
+    ImGui::Spacing();
+    ImGui::SeparatorText("Benchmark");
+    {
+        // 10k tweens as one frame would submit them: the std::function overload (default lerp wrapped per call)
+        // against the callable overload with the same (linear) easing and lerp, inlined.
+        static double bench_us_function = -1.0, bench_us_callable = -1.0, bench_us_array = -1.0;
+        const int tween_count = 10000;
+        const int frames = 20;
+        bool run = ImGui::Button("Run 10k tween benchmark");
+        DrawHelpTooltip("Times 10,000 Tween calls per frame, averaged over 20 frames, and one TweenArray call over 10,000 values. "
+            "The 20,000 tween states it creates are reclaimed by the stale state sweep once they stop being submitted.");
+        ImGui::BeginChild("tween_bench", ImVec2(0, ImGui::GetTextLineHeightWithSpacing() * 2.0f));
+        if (run)
+        {
+            using clock = std::chrono::high_resolution_clock;
+            const bool bench_inside = true;
+            float sink = 0.0f;
+            auto run_frames = [&](auto&& tween_one) {
+                for (int i = 0; i < tween_count; ++i) // first pass creates the tween states
+                    sink += tween_one(i);
+                auto t0 = clock::now();
+                for (int f = 0; f < frames; ++f)
+                    for (int i = 0; i < tween_count; ++i)
+                        sink += tween_one(i);
+                return std::chrono::duration<double, std::micro>(clock::now() - t0).count() / frames;
+            };
+            bench_us_function = run_frames([&](int i) {
+                ImGui::PushID(i);
+                float v = ImGui::Tween<float>("bench.fn", bench_inside, 1.0f, 1.0f, 0.0f, 1.0f);
+                ImGui::PopID();
+                return v;
+            });
+            bench_us_callable = run_frames([&](int i) {
+                ImGui::PushID(i);
+                float v = ImGui::Tween<float>("bench.callable", bench_inside, 1.0f, 1.0f, 0.0f, 1.0f, ImGuiTweenFlags_StartMin, ImGui::TweenEase::Linear{});
+                ImGui::PopID();
+                return v;
+            });
+            static ImVector<float> arr_min, arr_max, arr_out;
+            arr_min.resize(tween_count); arr_max.resize(tween_count); arr_out.resize(tween_count);
+            for (int i = 0; i < tween_count; ++i) { arr_min[i] = 0.0f; arr_max[i] = (float)i; }
+            bench_us_array = run_frames([&](int i) {
+                if (i == 0) // one call per frame covers every value
+                    ImGui::TweenArray("bench.array", bench_inside, 1.0f, 1.0f, arr_min.Data, arr_max.Data, arr_out.Data, tween_count);
+                return arr_out[i];
+            });
+            static volatile float bench_sink; bench_sink = sink; // keeps the loops from being optimized away
+        }
+        if (bench_us_function >= 0.0)
+            ImGui::Text("std::function: %.0f us/frame   callable: %.0f us/frame (x%.2f)",
+                bench_us_function, bench_us_callable, bench_us_function / ImMax(bench_us_callable, 1e-3));
+        if (bench_us_array >= 0.0)
+            ImGui::Text("TweenArray: %.1f us/frame (x%.0f)", bench_us_array, bench_us_function / ImMax(bench_us_array, 1e-3));
+        ImGui::EndChild();
+    }
+
+    // ------------------------ EASING BENCHMARK ------------------------
+    ImGui::Spacing();
+    ImGui::SeparatorText("Easing Benchmark");
+    {
+        // Every curve of the easing combo through its function pointer, the EasingKind switch and the table mode,
+        // with the largest table error against the exact curve (sampled at 10,001 points).
+        struct EaseBench { double ns_fn, ns_switch, ns_lut; float lut_err; };
+        static EaseBench results[EASING_FNS_COUNT];
+        static bool bench_done = false;
+        const int calls = 200000;
+        if (ImGui::Button("Run easing benchmark"))
+        {
+            using clock = std::chrono::high_resolution_clock;
+            float sink = 0.0f;
+            auto time_ns = [&](auto&& ease) {
+                auto t0 = clock::now();
+                for (int i = 0; i < calls; ++i)
+                    sink += ease((float)i * (1.0f / calls));
+                return std::chrono::duration<double, std::nano>(clock::now() - t0).count() / calls;
+            };
+            for (int n = 0; n < EASING_FNS_COUNT; ++n)
+            {
+                static volatile int kind_src; kind_src = (int)EASING_FNS[n].kind; // runtime kind, as picked from a combo
+                const EasingKind kind = (EasingKind)kind_src;
+                float (*fn)(float) = EASING_FNS[n].fn;
+                EaseBench& r = results[n];
+                r.ns_fn = fn ? time_ns([&](float t) { return fn(t); }) : -1.0;
+                r.ns_switch = time_ns([&](float t) { return Easing::Evaluate(kind, t); });
+                r.ns_lut = Easing::HasLut(kind) ? time_ns([&](float t) { return Easing::EvaluateLut(kind, t); }) : -1.0;
+                r.lut_err = 0.0f;
+                if (Easing::HasLut(kind))
+                    for (int i = 0; i <= 10000; ++i)
+                        r.lut_err = ImMax(r.lut_err, fabsf(Easing::EvaluateLut(kind, i * 1e-4f) - Easing::Evaluate(kind, i * 1e-4f)));
+            }
+            static volatile float bench_sink; bench_sink = sink;
+            bench_done = true;
+        }
+        DrawHelpTooltip("Times 200,000 evaluations of each curve. The table mode only applies to elastic and bounce, "
+            "which use pow/sin; the other curves are cheap enough to compute.");
+        if (bench_done && ImGui::BeginTable("easing_bench", 5, ImGuiTableFlags_SizingStretchProp | ImGuiTableFlags_RowBg))
+        {
+            ImGui::TableSetupColumn("Curve");
+            ImGui::TableSetupColumn("fn ptr (ns)");
+            ImGui::TableSetupColumn("switch (ns)");
+            ImGui::TableSetupColumn("table (ns)");
+            ImGui::TableSetupColumn("table max error");
+            ImGui::TableHeadersRow();
+            for (int n = 0; n < EASING_FNS_COUNT; ++n)
+            {
+                const EaseBench& r = results[n];
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0); ImGui::TextUnformatted(EASING_FNS[n].name);
+                ImGui::TableSetColumnIndex(1); if (r.ns_fn >= 0.0) ImGui::Text("%.2f", r.ns_fn); else ImGui::TextDisabled("-");
+                ImGui::TableSetColumnIndex(2); ImGui::Text("%.2f", r.ns_switch);
+                ImGui::TableSetColumnIndex(3); if (r.ns_lut >= 0.0) ImGui::Text("%.2f", r.ns_lut); else ImGui::TextDisabled("-");
+                ImGui::TableSetColumnIndex(4); if (r.ns_lut >= 0.0) ImGui::Text("%.5f", r.lut_err); else ImGui::TextDisabled("-");
+            }
+            ImGui::EndTable();
+        }
+    }
+
+    // ------------------------ STATE GC ------------------------
+    ImGui::Spacing();
+    ImGui::SeparatorText("Stale State");
+    {
+        static int last_collected = -1;
+        const ImGui::TweenPool& pool = ImGui::GetTweenPool();
+        const ImGui::WidgetStateTracker& tracker = ImGui::GetWidgetStateTracker();
+        ImGui::Text("Tweens: %d live, %d reclaimed", pool.Size(), pool.ReclaimedTotal);
+        ImGui::Text("Widget states: %d live, %d reclaimed", tracker.Entries.Size, tracker.ReclaimedTotal);
+        const ImGui::SpringDetail::SpringPool<1>& springs = ImGui::SpringDetail::GetSpringPool<1>();
+        ImGui::Text("Float springs: %d live, %d reclaimed", springs.Size(), springs.ReclaimedTotal);
+        ImGui::SliderInt("Stale after (frames)", &ImGui::TWEEN_STALE_FRAMES, 1, 3600);
+        ImGui::WIDGET_STATE_STALE_FRAMES = ImGui::SPRING_STALE_FRAMES = ImGui::TWEEN_STALE_FRAMES;
+        DrawHelpTooltip("Tweens and widget states (MultiToggle, BufferingBar, marquees, alignment groups) that are not submitted "
+            "for this many frames are dropped a few per frame. A dropped one starts over from its defaults if it comes back.");
+        if (ImGui::Button("Collect now"))
+            last_collected = ImGui::GcTweens() + ImGui::GcWidgetState() + ImGui::GcSprings();
+        if (last_collected >= 0)
+        {
+            ImGui::SameLine();
+            ImGui::Text("%d reclaimed", last_collected);
+        }
+    }
+
+    // ------------------------ LONG UPTIME ------------------------
+    ImGui::Spacing();
+    ImGui::SeparatorText("Long Uptime");
+    {
+        // The frame-by-frame check at 30 days of uptime is tests/test_long_uptime.cpp
+        if (ImGui::Button("Jump clock +30 days"))
+            GImGui->Time += 30.0 * 86400.0;
+        DrawHelpTooltip("Moves ImGui's clock forward by 30 days. Every widget should keep animating smoothly.");
+    }
+
     // Footer: quick tips
     ImGui::Spacing();
     ImGui::Separator();
@@ -0,0 +1,90 @@
+#pragma once
+// Minimal harness for tests that drive the widgets without a window or renderer.
+// Each test file is its own executable (see tests/ in CMakeLists.txt) and returns non-zero when a check failed.
+#include <cstdio>
+#include <cmath>
+
+#include <imgui.h>
+#include <imgui_internal.h>
+
+static int g_test_failures = 0;
+
+#define TEST_CHECK(cond, ...)                                                      \
+    do {                                                                           \
+        if (!(cond)) {                                                             \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n  ", __FILE__, __LINE__, #cond); \
+            std::fprintf(stderr, __VA_ARGS__);                                     \
+            std::fprintf(stderr, "\n");                                            \
+            g_test_failures++;                                                     \
+        }                                                                          \
+    } while (0)
+
+#define TEST_CHECK_NEAR(a, b, eps, what)                                           \
+    TEST_CHECK(std::fabs((double)(a) - (double)(b)) <= (eps), "%s: got %.7f, expected %.7f (frame %d)", \
+        what, (double)(a), (double)(b), ImGui::GetFrameCount())
+
+namespace Headless
+{
+    static const float kFrameDt = 1.0f / 60.0f;
+
+    // Creates a context whose font atlas needs no renderer
+    inline void CreateContext()
+    {
+        IMGUI_CHECKVERSION();
+        ImGui::CreateContext();
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = nullptr;
+        io.DisplaySize = ImVec2(1280.0f, 720.0f);
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures; // atlas textures are created lazily and never uploaded
+    }
+
+    // Starts a frame dt seconds after the previous one, with one full-screen window to put widgets in
+    inline void BeginFrame(float dt = kFrameDt)
+    {
+        ImGuiIO& io = ImGui::GetIO();
+        io.DeltaTime = dt;
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+        ImGui::SetNextWindowSize(io.DisplaySize);
+        ImGui::Begin("Headless", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoSavedSettings);
+    }
+
+    inline void EndFrame()
+    {
+        ImGui::End();
+        ImGui::Render();
+    }
+
+    // Moves the mouse to pos, then presses and releases the left button. draw() submits the widgets of every frame and
+    // returns true once the widget reacted to the click. Returns whether it did.
+    template<typename F>
+    inline bool Click(const ImVec2& pos, F&& draw)
+    {
+        ImGuiIO& io = ImGui::GetIO();
+        io.AddMousePosEvent(pos.x, pos.y);
+        BeginFrame();
+        draw();
+        EndFrame();
+
+        io.AddMouseButtonEvent(ImGuiMouseButton_Left, true);
+        bool reacted = false;
+        for (int f = 0; f < 4 && !reacted; ++f) // the input queue may spread the press over a frame
+        {
+            BeginFrame();
+            reacted = draw();
+            EndFrame();
+        }
+        io.AddMouseButtonEvent(ImGuiMouseButton_Left, false);
+        return reacted;
+    }
+
+    // Prints the result of the checks. Call after the last context is destroyed.
+    inline int Finish(const char* name)
+    {
+        if (g_test_failures == 0)
+            std::printf("%s: OK\n", name);
+        else
+            std::printf("%s: %d check(s) failed\n", name, g_test_failures);
+        return g_test_failures == 0 ? 0 : 1;
+    }
+}
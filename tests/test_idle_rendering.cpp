@@ -0,0 +1,211 @@
+// With idle rendering on, DemoManager::WaitForNextFrame only renders while GetAnimIdleTimeout() is 0 and otherwise sleeps
+// until the reported deadline. Replays that loop with no input arriving and checks that the toggle, tween, marquee and
+// ASCII flipbook still run to their final state, let the loop sleep once they are still, and never wake up late.
+#include "headless.h"
+
+#include <string>
+#include <vector>
+
+#include "toggle/imguiToggle.h"
+#include "tween/imguiTween.h"
+#include "customText/imguiAnimText.h"
+#include "asciiart/imguiAnimatedASCIIArt.h"
+
+static const double kMaxWait = 1.0; // DemoManager::idle_max_wait
+static const double kEps = 1e-4;
+
+// Spacing of the next frame, as WaitForNextFrame would produce it without input: the swap interval while something
+// animates, else the deadline (capped at kMaxWait). Counts the sleeps.
+static float IdleFrameDt(int* sleeps)
+{
+    const double timeout = ImGui::GetAnimIdleTimeout();
+    if (timeout <= 0.0)
+        return Headless::kFrameDt;
+    (*sleeps)++;
+    return (float)ImMin(timeout, kMaxWait);
+}
+
+static void TestNothingScheduled()
+{
+    Headless::CreateContext();
+    Headless::BeginFrame();
+    ImGui::TextUnformatted("still");
+    Headless::EndFrame();
+    TEST_CHECK(ImGui::GetAnimIdleTimeout() == AnimClock::kNoDeadline, "static frame asks for a timeout of %f", ImGui::GetAnimIdleTimeout());
+    ImGui::DestroyContext();
+}
+
+static void TestStillEffects()
+{
+    Headless::CreateContext();
+    const ImU32 stops[] = { IM_COL32(255, 0, 0, 255), IM_COL32(0, 0, 255, 255) };
+    for (int f = 0; f < 2; ++f) // the first frame builds the templates
+    {
+        Headless::BeginFrame();
+        ImGui::TextWobble("wobble", 3.0f, 1.5f, 0.0f);
+        ImGui::TextShaky("shaky", 1.5f, 3.0f, 0.0f);
+        ImGui::TextEffects("effects", ImGui::TextEffect().Wobble(3.0f, 1.5f, 0.0f).Shake(1.5f, 3.0f, 0.0f).Gradient(stops, 2, 1, 0.0f));
+        Headless::EndFrame();
+        TEST_CHECK(ImGui::GetAnimIdleTimeout() == AnimClock::kNoDeadline, "effects with speed 0 ask for a timeout of %f", ImGui::GetAnimIdleTimeout());
+    }
+    ImGui::DestroyContext();
+}
+
+static void TestClippedTypewriter()
+{
+    Headless::CreateContext();
+    Headless::BeginFrame();
+    const double start = ImGui::GetTime();
+    ImGui::SetCursorPosY(ImGui::GetIO().DisplaySize.y * 4.0f); // scrolled away
+    ImGui::TextTypewriterTimed("scrolled away report", start, 1.0f);
+    TEST_CHECK(!ImGui::IsItemVisible(), "typewriter is not clipped");
+    // 3 glyphs: the blanks and the line break emit none, the 2-byte UTF-8 character one
+    const bool done = ImGui::TextTypewriter("a b\n\xC3\xA9", 3.0f, 1.0f, 0.0f);
+    Headless::EndFrame();
+    TEST_CHECK(done, "clipped typewriter counted more glyphs than it draws");
+    TEST_CHECK(ImGui::GetAnimIdleTimeout() == AnimClock::kNoDeadline, "clipped typewriter keeps the loop busy");
+    ImGui::DestroyContext();
+}
+
+static void TestTween()
+{
+    Headless::CreateContext();
+    Headless::BeginFrame();
+    ImGui::Tween<float>("tween", false, 0.3f, 0.3f, 0.0f, 1.0f);
+    Headless::EndFrame();
+
+    float dt = Headless::kFrameDt, value = 0.0f;
+    int sleeps = 0;
+    for (int f = 0; f < 120 && sleeps == 0; ++f)
+    {
+        Headless::BeginFrame(dt);
+        value = ImGui::Tween<float>("tween", true, 0.3f, 0.3f, 0.0f, 1.0f);
+        Headless::EndFrame();
+        dt = IdleFrameDt(&sleeps);
+    }
+    TEST_CHECK(sleeps == 1, "tween never let the loop sleep");
+    TEST_CHECK(value == 1.0f, "loop went idle with the tween at %f", value);
+    TEST_CHECK(ImGui::GetAnimIdleTimeout() == AnimClock::kNoDeadline, "finished tween still schedules a frame");
+    ImGui::DestroyContext();
+}
+
+static float s_toggle_norm = -1.0f;
+static float RecordNorm(float t) { s_toggle_norm = t; return t; }
+
+static void TestToggle()
+{
+    Headless::CreateContext();
+    ImGui::ToggleConfig cfg;
+    cfg.easingFunc = RecordNorm;
+    bool on = false;
+
+    Headless::BeginFrame();
+    ImGui::Toggle("toggle", &on, cfg);
+    const ImRect bb(ImGui::GetItemRectMin(), ImGui::GetItemRectMax());
+    Headless::EndFrame();
+
+    const bool clicked = Headless::Click(bb.GetCenter(), [&]() {
+        const bool was_on = on;
+        ImGui::Toggle("toggle", &on, cfg);
+        return on != was_on;
+    });
+    TEST_CHECK(clicked && on, "click did not switch the toggle");
+
+    float dt = Headless::kFrameDt;
+    int sleeps = 0;
+    for (int f = 0; f < 120 && sleeps == 0; ++f)
+    {
+        s_toggle_norm = -1.0f;
+        Headless::BeginFrame(dt);
+        ImGui::Toggle("toggle", &on, cfg);
+        Headless::EndFrame();
+        dt = IdleFrameDt(&sleeps);
+    }
+    TEST_CHECK(sleeps == 1, "toggle never let the loop sleep");
+    TEST_CHECK(s_toggle_norm == 1.0f, "loop went idle with the toggle at %f", s_toggle_norm);
+    ImGui::DestroyContext();
+}
+
+static void TestMarquee()
+{
+    Headless::CreateContext();
+    const float delay = 0.5f;
+    float dt = Headless::kFrameDt;
+    int sleeps = 0, restarts = 0, prev_phase = 0;
+    double delay_start = 0.0;
+    for (int f = 0; f < 600 && restarts < 2; ++f)
+    {
+        Headless::BeginFrame(dt);
+        ImGui::TextMarquee("marquee", "Marquee", 100.0f, 400.0f, true, delay);
+        const int phase = ImGui::GetStateStorage()->GetInt(ImGui::GetID("marquee") + 1, -1); // 0 = scrolling, 1 = offscreen delay
+        const double now = ImGui::GetTime();
+        Headless::EndFrame();
+
+        const double timeout = ImGui::GetAnimIdleTimeout();
+        if (phase == 0)
+            TEST_CHECK(timeout == 0.0, "scrolling marquee let the loop sleep for %f s", timeout);
+        else
+            TEST_CHECK(timeout > 0.0 && timeout <= delay + kEps, "marquee delay asks for a timeout of %f s", timeout);
+        if (prev_phase == 0 && phase == 1)
+            delay_start = now;
+        if (prev_phase == 1 && phase == 0)
+        {
+            restarts++;
+            TEST_CHECK_NEAR(now - delay_start, delay, 1e-3, "marquee offscreen delay");
+        }
+        prev_phase = phase;
+        dt = IdleFrameDt(&sleeps);
+    }
+    TEST_CHECK(restarts == 2, "marquee restarted %d times", restarts);
+    TEST_CHECK(sleeps >= 2, "marquee never let the loop sleep during its delay");
+    ImGui::DestroyContext();
+}
+
+static void TestAsciiFlipbook()
+{
+    Headless::CreateContext();
+    const float frame_duration = 0.25f;
+    ImGui::AsciiAnimation anim;
+
+    Headless::BeginFrame();
+    anim = ImGui::CreateAsciiAnimation({ "(o  )", "( o )", "(  o)", "( o )" }, frame_duration, false);
+    anim.last_switch_time = ImGui::GetTime();
+    ImGui::DrawAsciiAnimation(anim);
+    Headless::EndFrame();
+
+    int sleeps = 0;
+    float dt = IdleFrameDt(&sleeps);
+    int switches = 0, shown = anim.current_frame;
+    double last_switch = anim.last_switch_time;
+    for (int f = 0; f < 200 && anim.playing; ++f)
+    {
+        Headless::BeginFrame(dt);
+        ImGui::DrawAsciiAnimation(anim);
+        const double now = ImGui::GetTime();
+        Headless::EndFrame();
+        if (anim.current_frame != shown)
+        {
+            switches++;
+            TEST_CHECK_NEAR(now - last_switch, frame_duration, 1e-3, "flipbook frame duration");
+            shown = anim.current_frame;
+            last_switch = now;
+        }
+        dt = IdleFrameDt(&sleeps);
+    }
+    TEST_CHECK(!anim.playing && anim.current_frame == 3 && switches == 3,
+        "flipbook stopped at frame %d after %d switches (playing = %d)", anim.current_frame, switches, (int)anim.playing);
+    TEST_CHECK(sleeps >= 3, "flipbook kept the loop busy between frames (%d sleeps)", sleeps);
+    TEST_CHECK(ImGui::GetAnimIdleTimeout() == AnimClock::kNoDeadline, "finished flipbook still schedules a frame");
+    ImGui::DestroyContext();
+}
+
+int main() {
+    TestNothingScheduled();
+    TestStillEffects();
+    TestClippedTypewriter();
+    TestTween();
+    TestToggle();
+    TestMarquee();
+    TestAsciiFlipbook();
+    return Headless::Finish("test_idle_rendering");
+}
@@ -0,0 +1,126 @@
+// 30 days into a session a float copy of ImGui::GetTime() only resolves ~250 ms. Runs the tween, MultiToggle and
+// BufferingBar at that uptime and checks their progress against the exact (double) timeline, frame by frame.
+#include "headless.h"
+
+#include "tween/imguiTween.h"
+#include "multiToggle/imguiMultiToggle.h"
+#include "progressBar/imguiProgressBar.h"
+
+static const double kUptime = 30.0 * 86400.0;
+static const double kEps = 1e-4;
+
+static void TestTween()
+{
+    const float dur = 0.25f;
+    Headless::BeginFrame();
+    ImGui::Tween<float>("tween", false, dur, dur, 0.0f, 1.0f);
+    Headless::EndFrame();
+
+    double start = -1.0;
+    float value = 0.0f;
+    for (int f = 0; f < 30; ++f)
+    {
+        Headless::BeginFrame();
+        if (f == 0)
+            start = ImGui::GetTime();
+        value = ImGui::Tween<float>("tween", true, dur, dur, 0.0f, 1.0f);
+        const double expected = ImMin((ImGui::GetTime() - start) / dur, 1.0);
+        TEST_CHECK_NEAR(value, expected, kEps, "tween");
+        Headless::EndFrame();
+    }
+    TEST_CHECK(value == 1.0f, "tween did not finish: %f", value);
+}
+
+// MultiToggle hands its linear progress to the easing, record it there
+static float s_toggle_norm = -1.0f;
+static float RecordNorm(float t) { s_toggle_norm = t; return t; }
+
+static void TestMultiToggle()
+{
+    const std::vector<const char*> labels = { "One", "Two" };
+    ImGui::MultiToggleConfig cfg;
+    cfg.size = ImVec2(200.0f, 30.0f);
+    cfg.easing = RecordNorm;
+    int current = 0;
+
+    // Lay it out once, then click the second section
+    Headless::BeginFrame();
+    ImGui::MultiToggle("toggle", &current, labels, cfg);
+    const ImRect bb(ImGui::GetItemRectMin(), ImGui::GetItemRectMax());
+    Headless::EndFrame();
+
+    double start = -1.0;
+    const bool clicked = Headless::Click(ImVec2(bb.Min.x + bb.GetWidth() * 0.75f, bb.GetCenter().y), [&]() {
+        if (!ImGui::MultiToggle("toggle", &current, labels, cfg))
+            return false;
+        start = ImGui::GetTime();
+        return true;
+    });
+    TEST_CHECK(clicked && current == 1, "click did not switch the toggle (current = %d)", current);
+    if (!clicked)
+        return;
+
+    bool finished = false;
+    for (int f = 0; f < 30 && !finished; ++f)
+    {
+        s_toggle_norm = -1.0f;
+        Headless::BeginFrame();
+        ImGui::MultiToggle("toggle", &current, labels, cfg);
+        const double expected = ImMin((ImGui::GetTime() - start) / cfg.anim_speed, 1.0);
+        TEST_CHECK_NEAR(s_toggle_norm, expected, kEps, "multitoggle progress");
+        finished = expected >= 1.0;
+        Headless::EndFrame();
+    }
+    TEST_CHECK(finished, "multitoggle animation did not finish");
+
+    // Settled: no more animation
+    s_toggle_norm = -1.0f;
+    Headless::BeginFrame();
+    ImGui::MultiToggle("toggle", &current, labels, cfg);
+    Headless::EndFrame();
+    TEST_CHECK(s_toggle_norm < 0.0f, "multitoggle still animating after it finished (%f)", s_toggle_norm);
+}
+
+static void TestBufferingBar()
+{
+    ImGui::BufferingBarConfig cfg;
+    const float target = 0.5f;
+
+    // Starting at 0 snaps, then the display chases the target with a 1 - exp(-dt / smooth_duration) step per frame
+    Headless::BeginFrame();
+    ImGui::BufferingBar("bar", 0.0f, true, cfg);
+    double last = ImGui::GetTime();
+    Headless::EndFrame();
+
+    double expected = 0.0;
+    float display = 0.0f;
+    for (int f = 0; f < 60; ++f)
+    {
+        Headless::BeginFrame();
+        ImGui::BufferingBar("bar", target, true, cfg);
+        display = ImGui::GetStateStorage()->GetFloat(ImGui::GetID("bar"), -1.0f);
+        const double now = ImGui::GetTime();
+        expected += (target - expected) * (1.0 - exp(-(now - last) / cfg.smooth_duration));
+        last = now;
+        TEST_CHECK_NEAR(display, expected, kEps, "buffering bar display");
+
+        // The circles loop on the same clock (phases compare modulo 1)
+        const double period = cfg.circle_period;
+        const double phase_err = fabs(ImGui::AnimPhase(1.0 / period) - fmod(now, period) / period);
+        TEST_CHECK_NEAR(ImMin(phase_err, 1.0 - phase_err), 0.0, kEps, "buffering bar phase error");
+        Headless::EndFrame();
+    }
+    TEST_CHECK(fabsf(display - target) < 1e-3f, "buffering bar did not reach its target: %f", display);
+}
+
+int main() {
+    Headless::CreateContext();
+    GImGui->Time = kUptime;
+
+    TestTween();
+    TestMultiToggle();
+    TestBufferingBar();
+
+    ImGui::DestroyContext();
+    return Headless::Finish("test_long_uptime");
+}